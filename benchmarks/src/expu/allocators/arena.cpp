@@ -0,0 +1,56 @@
+#include "benchmark/benchmark.h"
+
+#include <memory>
+
+#include "expu/allocators/arena.hpp"
+#include "expu/containers/darray.hpp"
+
+
+//////////////////////////////////////REQUEST-SCOPED ALLOCATION BENCHMARKS///////////////////////////////////////////////////////////////////////////////
+
+
+//Simulates a request, which creates and destroys many small arrays.
+template<class Container, class ... AllocArgs>
+static void _run_request(const size_t array_count, const size_t array_size, AllocArgs& ... alloc_args)
+{
+    for (size_t i = 0; i < array_count; ++i) {
+        Container arr(alloc_args...);
+
+        for (size_t j = 0; j < array_size; ++j)
+            arr.push_back(j);
+
+        benchmark::DoNotOptimize(arr.unchecked_back());
+    }
+}
+
+static void BM_request_std_allocator(benchmark::State& state) {
+    const auto array_count = static_cast<size_t>(state.range(0));
+    const auto array_size  = static_cast<size_t>(state.range(1));
+
+    for (auto _ : state)
+        _run_request<expu::darray<size_t>>(array_count, array_size);
+
+    state.SetItemsProcessed(state.iterations() * array_count * array_size);
+}
+
+static void BM_request_arena_allocator(benchmark::State& state) {
+    using allocator_type = expu::arena_allocator<size_t>;
+
+    const auto array_count = static_cast<size_t>(state.range(0));
+    const auto array_size  = static_cast<size_t>(state.range(1));
+
+    expu::arena arena;
+
+    for (auto _ : state) {
+        allocator_type alloc(arena);
+        _run_request<expu::darray<size_t, allocator_type>>(array_count, array_size, alloc);
+
+        //End of request, all memory is released at once
+        arena.reset();
+    }
+
+    state.SetItemsProcessed(state.iterations() * array_count * array_size);
+}
+
+BENCHMARK(BM_request_std_allocator)->ArgsProduct({ { 1000 }, { 4, 64, 1024 } });
+BENCHMARK(BM_request_arena_allocator)->ArgsProduct({ { 1000 }, { 4, 64, 1024 } });
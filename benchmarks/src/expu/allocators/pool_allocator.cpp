@@ -0,0 +1,31 @@
+#include "benchmark/benchmark.h"
+
+#include <memory>
+
+#include "expu/allocators/pool_allocator.hpp"
+#include "expu/containers/darray.hpp"
+#include "expu/containers/fixed_array.hpp"
+
+
+//////////////////////////////////////CONCURRENT SMALL ARRAY BENCHMARKS///////////////////////////////////////////////////////////////////////////////
+
+
+//Every thread creates and destroys many small arrays at once.
+template<class Alloc>
+static void BM_concurrent_small_arrays(benchmark::State& state) {
+    const auto array_size = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        expu::darray<size_t, Alloc> arr;
+        for (size_t i = 0; i < array_size; ++i)
+            arr.push_back(i);
+
+        const expu::fixed_array<size_t, Alloc> copy(arr.begin(), arr.end());
+        benchmark::DoNotOptimize(copy.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * array_size);
+}
+
+BENCHMARK(BM_concurrent_small_arrays<std::allocator<size_t>>)->Arg(4)->Arg(64)->ThreadRange(1, 8);
+BENCHMARK(BM_concurrent_small_arrays<expu::pool_allocator<size_t>>)->Arg(4)->Arg(64)->ThreadRange(1, 8);
@@ -0,0 +1,56 @@
+#include "benchmark/benchmark.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "expu/containers/adaptive_map.hpp"
+#include "expu/containers/linear_map.hpp"
+
+
+//////////////////////////////////////ADAPTIVE MAP BENCHMARKS///////////////////////////////////////////////////////////////////////////////
+
+
+//Random keys, the first size of which are inserted, hence lookups of the remainder miss.
+template<class Key>
+static std::vector<Key> _random_keys(const size_t size)
+{
+    std::mt19937_64 generator(size);
+
+    std::vector<Key> keys(2 * size);
+    for (auto& key : keys) {
+        if constexpr (std::is_same_v<Key, std::string>)
+            key = "header-" + std::to_string(generator());
+        else
+            key = static_cast<Key>(generator());
+    }
+
+    return keys;
+}
+
+template<class Map>
+static void BM_small_map_find(benchmark::State& state) {
+    using key_type = typename Map::key_type;
+
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto keys = _random_keys<key_type>(size);
+
+    Map map;
+    for (size_t i = 0; i < size; ++i)
+        map[keys[i]] = i;
+
+    //Alternates hits and misses
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.find(keys[index]));
+        index = (index + size + 1) % keys.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_small_map_find, expu::linear_map<uint64_t, size_t>)->RangeMultiplier(2)->Range(4, 1 << 12);
+BENCHMARK_TEMPLATE(BM_small_map_find, expu::adaptive_map<uint64_t, size_t>)->RangeMultiplier(2)->Range(4, 1 << 12);
+
+BENCHMARK_TEMPLATE(BM_small_map_find, expu::linear_map<std::string, size_t>)->RangeMultiplier(2)->Range(4, 1 << 12);
+BENCHMARK_TEMPLATE(BM_small_map_find, expu::adaptive_map<std::string, size_t>)->RangeMultiplier(2)->Range(4, 1 << 12);
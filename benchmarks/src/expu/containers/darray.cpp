@@ -1,8 +1,10 @@
 #include "benchmark/benchmark.h"
 
 #include <vector>
+#include <algorithm>
 
 #include "expu/containers/darray.hpp"
+#include "expu/containers/growth_policy.hpp"
 
 template<class Container>
 static void BM_push_back(benchmark::State& state) {
@@ -23,4 +25,95 @@ static void BM_push_back(benchmark::State& state) {
 //BENCHMARK(BM_push_back<std::vector<int>>)->DenseRange(8, 23);
 BENCHMARK(BM_push_back<expu::darray<int>>)->DenseRange(8, 23);
 
+
+//Appends batches of 256 elements, as a parser ingesting records would
+template<bool UseAppendRange>
+static void BM_batch_append(benchmark::State& state) {
+    const size_t element_count = 1 << state.range(0);
+    const std::vector<int> batch(256, 1);
+
+    for (auto _ : state) {
+        expu::darray<int> arr;
+
+        for (size_t i = 0; i < element_count; i += batch.size()) {
+            if constexpr (UseAppendRange)
+                arr.append_range(batch);
+            else {
+                for (const int value : batch)
+                    arr.push_back(value);
+            }
+        }
+
+        benchmark::DoNotOptimize(arr.unchecked_back());
+    }
+
+    state.SetBytesProcessed(state.iterations() * element_count * sizeof(int));
+}
+
+BENCHMARK(BM_batch_append<false>)->DenseRange(10, 22, 4);
+BENCHMARK(BM_batch_append<true>)->DenseRange(10, 22, 4);
+
+//////////////////////////////////////GROWTH POLICY BENCHMARKS///////////////////////////////////////////////////////////////////////////////
+
+
+//Note: Peak RSS of the process cannot be reset between benchmarks, hence the peak number of bytes held
+//by the container's allocator is reported instead. Includes both buffers alive during a re-allocation.
+struct _allocation_stats
+{
+    static inline size_t current = 0;
+    static inline size_t peak    = 0;
+};
+
+template<class Type>
+struct counting_allocator : public std::allocator<Type>
+{
+    using value_type = Type;
+
+    counting_allocator() = default;
+
+    template<class OtherType>
+    counting_allocator(const counting_allocator<OtherType>&) noexcept {}
+
+    [[nodiscard]] Type* allocate(const size_t n)
+    {
+        _allocation_stats::current += n * sizeof(Type);
+        _allocation_stats::peak     = std::max(_allocation_stats::peak, _allocation_stats::current);
+
+        return std::allocator<Type>::allocate(n);
+    }
+
+    void deallocate(Type* const ptr, const size_t n) noexcept
+    {
+        _allocation_stats::current -= n * sizeof(Type);
+        std::allocator<Type>::deallocate(ptr, n);
+    }
+};
+
+template<class GrowthPolicy>
+static void BM_push_back_growth_policy(benchmark::State& state) {
+    using container_type = expu::darray<size_t, counting_allocator<size_t>, GrowthPolicy>;
+
+    const size_t push_back_count = 1 << state.range(0);
+    _allocation_stats::peak = 0;
+
+    for (auto _ : state) {
+        container_type arr;
+
+        for (size_t i = 0; i < push_back_count; ++i)
+            arr.push_back(i);
+
+        benchmark::DoNotOptimize(arr.unchecked_back());
+    }
+
+    const size_t bytes = push_back_count * sizeof(size_t);
+    state.SetBytesProcessed(state.iterations() * bytes);
+    state.counters["peak_bytes"]    = static_cast<double>(_allocation_stats::peak);
+    state.counters["peak_overhead"] = static_cast<double>(_allocation_stats::peak) / bytes;
+}
+
+BENCHMARK(BM_push_back_growth_policy<expu::geometric_growth<>>)->DenseRange(8, 23, 5);
+BENCHMARK(BM_push_back_growth_policy<expu::doubling_growth>)->DenseRange(8, 23, 5);
+BENCHMARK(BM_push_back_growth_policy<expu::page_rounded_growth<>>)->DenseRange(8, 23, 5);
+BENCHMARK(BM_push_back_growth_policy<expu::capped_growth<(1 << 16)>>)->DenseRange(8, 23, 5);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,64 @@
+#include "benchmark/benchmark.h"
+
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "expu/containers/flat_hash_map.hpp"
+
+
+//////////////////////////////////////FLAT HASH MAP BENCHMARKS///////////////////////////////////////////////////////////////////////////////
+
+
+//Random keys, the first size of which are inserted, hence lookups of the remainder miss.
+static std::vector<uint64_t> _random_keys(const size_t size)
+{
+    std::mt19937_64 generator(size);
+
+    std::vector<uint64_t> keys(2 * size);
+    for (auto& key : keys)
+        key = generator();
+
+    return keys;
+}
+
+template<class Map>
+static void BM_hash_map_find(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto keys = _random_keys(size);
+
+    Map map;
+    for (size_t i = 0; i < size; ++i)
+        map[keys[i]] = i;
+
+    //Alternates hits and misses
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.find(keys[index]));
+        index = (index + size + 1) % keys.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<class Map>
+static void BM_hash_map_insert(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto keys = _random_keys(size);
+
+    for (auto _ : state) {
+        Map map;
+        for (size_t i = 0; i < size; ++i)
+            map[keys[i]] = i;
+
+        benchmark::DoNotOptimize(map.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+BENCHMARK_TEMPLATE(BM_hash_map_find, expu::flat_hash_map<uint64_t, size_t>)->RangeMultiplier(16)->Range(16, 1 << 24);
+BENCHMARK_TEMPLATE(BM_hash_map_find, std::unordered_map<uint64_t, size_t>)->RangeMultiplier(16)->Range(16, 1 << 24);
+
+BENCHMARK_TEMPLATE(BM_hash_map_insert, expu::flat_hash_map<uint64_t, size_t>)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(BM_hash_map_insert, std::unordered_map<uint64_t, size_t>)->RangeMultiplier(16)->Range(16, 1 << 20);
@@ -0,0 +1,107 @@
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "expu/containers/flat_map.hpp"
+
+
+//////////////////////////////////////FLAT MAP BENCHMARKS///////////////////////////////////////////////////////////////////////////////
+
+
+//Random keys, the first size of which are inserted, hence lookups of the remainder (mostly) miss.
+static std::vector<uint64_t> _random_keys(const size_t size)
+{
+    std::mt19937_64 generator(size);
+
+    std::vector<uint64_t> keys(2 * size);
+    for (auto& key : keys)
+        key = generator();
+
+    return keys;
+}
+
+static void BM_std_lower_bound_find(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto keys = _random_keys(size);
+
+    std::vector<uint64_t> sorted(keys.begin(), keys.begin() + size);
+    std::ranges::sort(sorted);
+
+    size_t index = 0;
+    for (auto _ : state) {
+        const auto it = std::lower_bound(sorted.begin(), sorted.end(), keys[index]);
+        benchmark::DoNotOptimize(it != sorted.end() && *it == keys[index]);
+        index = (index + size + 1) % keys.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<class Map>
+static void BM_ordered_map_find(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto keys = _random_keys(size);
+
+    std::vector<std::pair<uint64_t, size_t>> elements;
+    for (size_t i = 0; i < size; ++i)
+        elements.emplace_back(keys[i], i);
+
+    //Note: Inserting one at a time into an expu::flat_map would take quadratic time
+    Map map;
+    if constexpr (requires { map.insert_range(elements); })
+        map.insert_range(elements);
+    else
+        map.insert(elements.begin(), elements.end());
+
+    //Alternates hits and misses
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.find(keys[index]));
+        index = (index + size + 1) % keys.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_flat_map_try_emplace(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto keys = _random_keys(size);
+
+    for (auto _ : state) {
+        expu::flat_map<uint64_t, size_t> map;
+        for (size_t i = 0; i < size; ++i)
+            map.try_emplace(keys[i], i);
+
+        benchmark::DoNotOptimize(map.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+static void BM_flat_map_insert_range(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto keys = _random_keys(size);
+
+    std::vector<std::pair<uint64_t, size_t>> elements;
+    for (size_t i = 0; i < size; ++i)
+        elements.emplace_back(keys[i], i);
+
+    for (auto _ : state) {
+        expu::flat_map<uint64_t, size_t> map;
+        map.insert_range(elements);
+
+        benchmark::DoNotOptimize(map.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+BENCHMARK(BM_std_lower_bound_find)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ordered_map_find, expu::flat_map<uint64_t, size_t>)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ordered_map_find, std::map<uint64_t, size_t>)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+BENCHMARK(BM_flat_map_try_emplace)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_flat_map_insert_range)->RangeMultiplier(16)->Range(16, 1 << 16);
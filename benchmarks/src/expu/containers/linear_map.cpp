@@ -0,0 +1,81 @@
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "expu/containers/linear_map.hpp"
+#include "expu/containers/split_linear_map.hpp"
+
+
+//////////////////////////////////////LINEAR MAP BENCHMARKS///////////////////////////////////////////////////////////////////////////////
+
+
+//Keys looked up in random order, all of which are present.
+static std::vector<int> _lookup_keys(const size_t size)
+{
+    std::mt19937 generator(static_cast<uint32_t>(size));
+
+    std::vector<int> keys(1024);
+    for (auto& key : keys)
+        key = static_cast<int>(generator() % size);
+
+    return keys;
+}
+
+static void BM_linear_map_find_scalar(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto keys = _lookup_keys(size);
+
+    std::vector<std::pair<int, int>> elements;
+    for (size_t i = 0; i < size; ++i)
+        elements.emplace_back(static_cast<int>(i), static_cast<int>(i));
+
+    for (auto _ : state)
+        for (const int key : keys)
+            benchmark::DoNotOptimize(std::ranges::find(elements, key, &std::pair<int, int>::first));
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+static void BM_linear_map_find(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto keys = _lookup_keys(size);
+
+    expu::linear_map<int, int> map;
+    for (size_t i = 0; i < size; ++i)
+        map[static_cast<int>(i)] = static_cast<int>(i);
+
+    for (auto _ : state)
+        for (const int key : keys)
+            benchmark::DoNotOptimize(map.find(key));
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+BENCHMARK(BM_linear_map_find_scalar)->RangeMultiplier(2)->Range(8, 128);
+BENCHMARK(BM_linear_map_find)->RangeMultiplier(2)->Range(8, 128);
+
+
+//Mapped values spanning several cache lines, as with per-connection state keyed by a descriptor.
+struct _large_mapped { char bytes[256]; };
+
+template<class Map>
+static void BM_large_mapped_find(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto keys = _lookup_keys(size);
+
+    Map map;
+    for (size_t i = 0; i < size; ++i)
+        map[static_cast<int>(i)] = _large_mapped{};
+
+    for (auto _ : state)
+        for (const int key : keys)
+            benchmark::DoNotOptimize(map.find(key));
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+BENCHMARK_TEMPLATE(BM_large_mapped_find, expu::linear_map<int, _large_mapped>)->RangeMultiplier(2)->Range(8, 128);
+BENCHMARK_TEMPLATE(BM_large_mapped_find, expu::split_linear_map<int, _large_mapped>)->RangeMultiplier(2)->Range(8, 128);
@@ -0,0 +1,70 @@
+#include "benchmark/benchmark.h"
+
+#include <random>
+#include <span>
+#include <vector>
+
+#include "expu/containers/darray.hpp"
+#include "expu/containers/packed_array.hpp"
+
+
+//////////////////////////////////////PACKED ARRAY BENCHMARKS///////////////////////////////////////////////////////////////////////////////
+
+
+//Random 20-bit ids, as stored in id columns.
+static std::vector<uint32_t> _random_ids(const size_t size)
+{
+    std::mt19937 generator(static_cast<uint32_t>(size));
+
+    std::vector<uint32_t> ids(size);
+    for (auto& id : ids)
+        id = generator() & expu::packed_array<20>::max_value;
+
+    return ids;
+}
+
+static void BM_packed_unpack_elementwise(benchmark::State& state) {
+    const auto ids = _random_ids(static_cast<size_t>(state.range(0)));
+    const expu::packed_array<20> packed(ids.begin(), ids.end());
+
+    std::vector<uint32_t> out(ids.size());
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < packed.size(); ++i)
+            out[i] = packed[i];
+
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * packed.size());
+}
+
+static void BM_packed_unpack_bulk(benchmark::State& state) {
+    const auto ids = _random_ids(static_cast<size_t>(state.range(0)));
+    const expu::packed_array<20> packed(ids.begin(), ids.end());
+
+    std::vector<uint32_t> out(ids.size());
+
+    for (auto _ : state) {
+        packed.unpack_into(out);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * packed.size());
+}
+
+static void BM_packed_pack_bulk(benchmark::State& state) {
+    const auto ids = _random_ids(static_cast<size_t>(state.range(0)));
+    expu::packed_array<20> packed(ids.size());
+
+    for (auto _ : state) {
+        packed.pack(ids);
+        benchmark::DoNotOptimize(packed.begin()._word());
+    }
+
+    state.SetItemsProcessed(state.iterations() * packed.size());
+}
+
+BENCHMARK(BM_packed_unpack_elementwise)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_packed_unpack_bulk)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_packed_pack_bulk)->Range(1 << 10, 1 << 20);
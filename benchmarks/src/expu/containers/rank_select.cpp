@@ -0,0 +1,123 @@
+#include "benchmark/benchmark.h"
+
+#include <bit>
+#include <random>
+#include <vector>
+
+#include "expu/containers/fixed_array.hpp"
+#include "expu/containers/rank_select.hpp"
+
+
+//////////////////////////////////////RANK/SELECT BENCHMARKS///////////////////////////////////////////////////////////////////////////////
+
+
+//Bitmap of 2^size_log2 bits, with roughly every other bit set.
+static expu::fixed_array<bool> _random_bits(const size_t size_log2)
+{
+    std::mt19937_64 generator(size_log2);
+    std::bernoulli_distribution distribution(0.5);
+
+    std::vector<bool> bits(size_t(1) << size_log2);
+    for (auto&& bit : bits)
+        bit = distribution(generator);
+
+    return expu::fixed_array<bool>(bits.begin(), bits.end());
+}
+
+static std::vector<size_t> _random_queries(const size_t max)
+{
+    std::mt19937_64 generator(max);
+    std::uniform_int_distribution<size_t> distribution(0, max - 1);
+
+    std::vector<size_t> queries(1024);
+    for (auto& query : queries)
+        query = distribution(generator);
+
+    return queries;
+}
+
+//Counts a word at a time, up to pos.
+static size_t _naive_rank(const expu::fixed_array<bool>& bits, const size_t pos)
+{
+    return static_cast<size_t>(expu::count(bits.begin(), bits.begin() + pos, true));
+}
+
+//Counts a word at a time, up to the word containing the k-th set bit.
+static size_t _naive_select(const expu::fixed_array<bool>& bits, size_t k)
+{
+    const uint64_t* const words = bits.begin()._word();
+
+    for (size_t index = 0; ; ++index) {
+        const auto word_rank = static_cast<size_t>(std::popcount(words[index]));
+
+        if (k < word_rank)
+            return (index << 6) + expu::_select_in_word(words[index], k);
+
+        k -= word_rank;
+    }
+}
+
+static void BM_rank_naive(benchmark::State& state) {
+    const auto bits    = _random_bits(state.range(0));
+    const auto queries = _random_queries(bits.size());
+
+    for (auto _ : state)
+        for (const size_t pos : queries)
+            benchmark::DoNotOptimize(_naive_rank(bits, pos));
+
+    state.SetItemsProcessed(state.iterations() * queries.size());
+}
+
+static void BM_rank_index(benchmark::State& state) {
+    const auto bits    = _random_bits(state.range(0));
+    const auto queries = _random_queries(bits.size());
+
+    const expu::rank_select index(bits);
+
+    for (auto _ : state)
+        for (const size_t pos : queries)
+            benchmark::DoNotOptimize(index.rank(pos));
+
+    state.SetItemsProcessed(state.iterations() * queries.size());
+}
+
+static void BM_select_naive(benchmark::State& state) {
+    const auto bits    = _random_bits(state.range(0));
+    const auto queries = _random_queries(bits.count());
+
+    for (auto _ : state)
+        for (const size_t k : queries)
+            benchmark::DoNotOptimize(_naive_select(bits, k));
+
+    state.SetItemsProcessed(state.iterations() * queries.size());
+}
+
+static void BM_select_index(benchmark::State& state) {
+    const auto bits    = _random_bits(state.range(0));
+    const auto queries = _random_queries(bits.count());
+
+    const expu::rank_select index(bits);
+
+    for (auto _ : state)
+        for (const size_t k : queries)
+            benchmark::DoNotOptimize(index.select(k));
+
+    state.SetItemsProcessed(state.iterations() * queries.size());
+}
+
+static void BM_rank_select_build(benchmark::State& state) {
+    const auto bits = _random_bits(state.range(0));
+
+    for (auto _ : state) {
+        const expu::rank_select index(bits);
+        benchmark::DoNotOptimize(index.count());
+    }
+
+    state.SetBytesProcessed(state.iterations() * (bits.size() >> 3));
+}
+
+BENCHMARK(BM_rank_naive)->DenseRange(16, 24, 4);
+BENCHMARK(BM_rank_index)->DenseRange(16, 24, 4);
+BENCHMARK(BM_select_naive)->DenseRange(16, 24, 4);
+BENCHMARK(BM_select_index)->DenseRange(16, 24, 4);
+BENCHMARK(BM_rank_select_build)->DenseRange(16, 24, 4);
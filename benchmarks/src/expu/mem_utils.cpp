@@ -0,0 +1,40 @@
+#include "benchmark/benchmark.h"
+
+#include <cstring>
+#include <vector>
+
+#include "expu/mem_utils.hpp"
+
+
+//////////////////////////////////////STREAMING COPY BENCHMARKS///////////////////////////////////////////////////////////////////////////////
+
+
+static void BM_copy_memmove(benchmark::State& state) {
+    const std::vector<char> source(static_cast<size_t>(state.range(0)), 'a');
+    std::vector<char> output(source.size());
+
+    for (auto _ : state) {
+        std::memmove(output.data(), source.data(), source.size());
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * source.size());
+}
+
+static void BM_copy_non_temporal(benchmark::State& state) {
+    const std::vector<char> source(static_cast<size_t>(state.range(0)), 'a');
+    std::vector<char> output(source.size());
+
+    for (auto _ : state) {
+        expu::copy(expu::non_temporal, source.begin(), source.end(), output.begin());
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * source.size());
+}
+
+//From L2 sized buffers, where streaming only loses the cached copy, up to buffers far larger than the last level cache
+BENCHMARK(BM_copy_memmove)->RangeMultiplier(8)->Range(int64_t(1) << 15, int64_t(1) << 30)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_copy_non_temporal)->RangeMultiplier(8)->Range(int64_t(1) << 15, int64_t(1) << 30)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,234 @@
+#ifndef EXPU_ARENA_HPP_INCLUDED
+#define EXPU_ARENA_HPP_INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include "expu/debug.hpp"
+
+namespace expu {
+
+    //Monotonic (bump) allocator. Memory is carved out of a chain of chunks, each twice the size of the previous,
+    //and is only given back to the system on reset() or destruction. Individual deallocations are ignored, unless
+    //the block was the last one allocated, in which case its memory may be reused.
+    //Note: Not thread-safe. Intended for request-scoped data, which is released all at once.
+    class arena
+    {
+    private:
+        struct _chunk
+        {
+            _chunk* prev;
+            size_t  size; //Size of the chunk, including this header.
+        };
+
+        static constexpr size_t _header_size = (sizeof(_chunk) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+    public:
+        explicit arena(const size_t initial_chunk_size = 4096) noexcept:
+            _next_chunk_size(std::max(initial_chunk_size, 2 * _header_size)) {}
+
+        arena(const arena&)            = delete;
+        arena& operator=(const arena&) = delete;
+
+        ~arena() noexcept
+        {
+            release();
+        }
+
+    private:
+        [[nodiscard]] static char* _chunk_first(_chunk* const chunk) noexcept
+        {
+            return reinterpret_cast<char*>(chunk) + _header_size;
+        }
+
+        [[nodiscard]] static char* _chunk_end(_chunk* const chunk) noexcept
+        {
+            return reinterpret_cast<char*>(chunk) + chunk->size;
+        }
+
+        [[nodiscard]] static char* _align_up(char* const ptr, const size_t alignment) noexcept
+        {
+            const auto address = reinterpret_cast<uintptr_t>(ptr);
+            return ptr + (((address + alignment - 1) & ~(alignment - 1)) - address);
+        }
+
+        //Allocates a new chunk, able to fit atleast bytes aligned to alignment.
+        void _grow(const size_t bytes, const size_t alignment)
+        {
+            constexpr size_t max_size = std::numeric_limits<size_t>::max();
+            if (max_size - _header_size - alignment < bytes)
+                throw std::bad_array_new_length();
+
+            const size_t required   = _header_size + alignment + bytes;
+            const size_t chunk_size = std::max(_next_chunk_size, required);
+
+            _chunk* const chunk = static_cast<_chunk*>(::operator new(chunk_size));
+            chunk->prev = _current;
+            chunk->size = chunk_size;
+
+            _current = chunk;
+            _cursor  = _chunk_first(chunk);
+            _end     = _chunk_end(chunk);
+
+            _next_chunk_size = (max_size / 2 < chunk_size) ? chunk_size : chunk_size * 2;
+        }
+
+    public:
+        [[nodiscard]] void* allocate(const size_t bytes, const size_t alignment = alignof(std::max_align_t))
+        {
+            EXPU_VERIFY_DEBUG(alignment && !(alignment & (alignment - 1)), "Alignment must be a power of 2!");
+
+            char* first = _cursor ? _align_up(_cursor, alignment) : nullptr;
+
+            if (!first || static_cast<size_t>(_end - first) < bytes) {
+                _grow(bytes, alignment);
+                first = _align_up(_cursor, alignment);
+            }
+
+            _cursor = first + bytes;
+            return first;
+        }
+
+        //Memory is only reclaimed if ptr is the last block allocated.
+        void deallocate(void* const ptr, const size_t bytes) noexcept
+        {
+            if (static_cast<char*>(ptr) + bytes == _cursor)
+                _cursor = static_cast<char*>(ptr);
+        }
+
+        //Grows the last block allocated in place, returns false if ptr isn't the last block or doesn't fit.
+        [[nodiscard]] bool try_expand(void* const ptr, const size_t bytes, const size_t new_bytes) noexcept
+        {
+            char* const first = static_cast<char*>(ptr);
+
+            if (first + bytes != _cursor || static_cast<size_t>(_end - first) < new_bytes)
+                return false;
+
+            _cursor = first + new_bytes;
+            return true;
+        }
+
+        //Releases all memory allocated, except for the most recent (and largest) chunk, which is reused.
+        //Note: All blocks allocated from this arena are invalidated.
+        void reset() noexcept
+        {
+            if (!_current)
+                return;
+
+            for (_chunk* chunk = _current->prev; chunk; ) {
+                _chunk* const prev = chunk->prev;
+                ::operator delete(chunk, chunk->size);
+                chunk = prev;
+            }
+
+            _current->prev = nullptr;
+            _cursor = _chunk_first(_current);
+        }
+
+        //Releases all memory back to the system.
+        void release() noexcept
+        {
+            for (_chunk* chunk = _current; chunk; ) {
+                _chunk* const prev = chunk->prev;
+                ::operator delete(chunk, chunk->size);
+                chunk = prev;
+            }
+
+            _current = nullptr;
+            _cursor  = nullptr;
+            _end     = nullptr;
+        }
+
+    public:
+        //Number of bytes remaining in the current chunk.
+        [[nodiscard]] size_t remaining() const noexcept
+        {
+            return static_cast<size_t>(_end - _cursor);
+        }
+
+    private:
+        _chunk* _current = nullptr;
+        char*   _cursor  = nullptr;
+        char*   _end     = nullptr;
+
+        size_t _next_chunk_size;
+    };
+
+    //Stateful allocator, allocating from an expu::arena. The arena must outlive all containers using it.
+    //Note: As with std::pmr, allocators never propagate, hence containers using different arenas copy (or move)
+    //elements individually rather than stealing memory between arenas.
+    template<class Type>
+    class arena_allocator
+    {
+    public:
+        using value_type      = Type;
+        using size_type       = size_t;
+        using difference_type = ptrdiff_t;
+
+        using is_always_equal                        = std::false_type;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::false_type;
+        using propagate_on_container_swap            = std::false_type;
+
+        template<class OtherType>
+        friend class arena_allocator;
+
+    public:
+        arena_allocator(arena& arena) noexcept:
+            _arena(std::addressof(arena)) {}
+
+        template<class OtherType>
+        arena_allocator(const arena_allocator<OtherType>& other) noexcept:
+            _arena(other._arena) {}
+
+    public:
+        [[nodiscard]] Type* allocate(const size_type n)
+        {
+            if (max_size() < n)
+                throw std::bad_array_new_length();
+
+            return static_cast<Type*>(_arena->allocate(n * sizeof(Type), alignof(Type)));
+        }
+
+        void deallocate(Type* const ptr, const size_type n) noexcept
+        {
+            _arena->deallocate(ptr, n * sizeof(Type));
+        }
+
+    public: //Allocator extensions (see expu::_alloc_can_try_expand)
+        [[nodiscard]] bool try_expand(Type* const ptr, const size_type n, const size_type new_n) noexcept
+        {
+            if (max_size() < new_n)
+                return false;
+
+            return _arena->try_expand(ptr, n * sizeof(Type), new_n * sizeof(Type));
+        }
+
+    public:
+        [[nodiscard]] constexpr size_type max_size() const noexcept
+        {
+            return static_cast<size_type>(std::numeric_limits<difference_type>::max()) / sizeof(Type);
+        }
+
+        [[nodiscard]] arena& resource() const noexcept
+        {
+            return *_arena;
+        }
+
+    private:
+        arena* _arena;
+    };
+
+    template<class Type, class OtherType>
+    [[nodiscard]] bool operator==(const arena_allocator<Type>& lhs, const arena_allocator<OtherType>& rhs) noexcept
+    {
+        return std::addressof(lhs.resource()) == std::addressof(rhs.resource());
+    }
+}
+
+#endif // !EXPU_ARENA_HPP_INCLUDED
@@ -0,0 +1,240 @@
+#ifndef EXPU_PAGE_ALLOCATOR_HPP_INCLUDED
+#define EXPU_PAGE_ALLOCATOR_HPP_INCLUDED
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define EXPU_PAGE_ALLOCATOR_USES_MMAP 1
+#include <sys/mman.h> //For access to mmap, munmap, mremap and madvise
+#include <unistd.h>   //For access to sysconf
+#else
+#define EXPU_PAGE_ALLOCATOR_USES_MMAP 0
+#endif
+
+namespace expu {
+
+    [[nodiscard]] inline size_t page_size() noexcept
+    {
+#if EXPU_PAGE_ALLOCATOR_USES_MMAP
+        static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        return size;
+#else
+        return 4096;
+#endif
+    }
+
+    //Size of a (transparent) huge page on x86-64 and most aarch64 configurations.
+    inline constexpr size_t huge_page_size = size_t(1) << 21;
+
+    //Allocates memory directly from the OS in whole pages. On linux, blocks may be grown without copying their
+    //contents through mremap (see expu::darray growth), making it well suited to very large arrays.
+    //Alignment (in bytes, 0 meaning the page size) may exceed the page size, such as to align blocks to huge pages.
+    //If HugePages is set, blocks are rounded up to whole huge pages and advised (MADV_HUGEPAGE) to be backed by
+    //transparent huge pages, reducing TLB misses when traversing large buffers.
+    //Note: Every allocation occupies atleast one page (or huge page), avoid for small containers.
+    template<class Type, size_t Alignment, bool HugePages>
+    class _page_allocator
+    {
+        static_assert(Alignment == 0 || std::has_single_bit(Alignment), "Alignment must be a power of 2!");
+
+    public:
+        using value_type      = Type;
+        using size_type       = size_t;
+        using difference_type = ptrdiff_t;
+
+        using is_always_equal                        = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+
+        //Note: Required, as allocator_traits cannot rebind allocators with non-type template parameters
+        template<class OtherType>
+        struct rebind { using other = _page_allocator<OtherType, Alignment, HugePages>; };
+
+    public:
+        constexpr _page_allocator() noexcept = default;
+
+        template<class OtherType>
+        constexpr _page_allocator(const _page_allocator<OtherType, Alignment, HugePages>&) noexcept {}
+
+    private:
+        [[nodiscard]] static size_t _alignment() noexcept
+        {
+            return Alignment ? std::max(Alignment, page_size()) : page_size();
+        }
+
+        [[nodiscard]] static constexpr size_t _granularity() noexcept
+        {
+            return HugePages ? huge_page_size : 0;
+        }
+
+        //Number of bytes actually mapped for a block of n elements.
+        [[nodiscard]] static size_t _mapped_size(const size_type n) noexcept
+        {
+            const size_t bytes = n ? n * sizeof(Type) : 1;
+            const size_t mask  = std::max(page_size(), _granularity()) - 1;
+
+            return (bytes + mask) & ~mask;
+        }
+
+#if EXPU_PAGE_ALLOCATOR_USES_MMAP
+        static void _advise([[maybe_unused]] void* const ptr, [[maybe_unused]] const size_t size) noexcept
+        {
+#ifdef MADV_HUGEPAGE
+            //Note: Merely a hint, failure (e.g. transparent huge pages disabled) leaves regular pages in use
+            if constexpr (HugePages)
+                madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+        }
+
+        //Maps size bytes aligned to _alignment(), returns MAP_FAILED on failure.
+        [[nodiscard]] static void* _map(const size_t size) noexcept
+        {
+            const size_t alignment = _alignment();
+
+            if (alignment <= page_size())
+                return mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+            //Over-map, then unmap the misaligned head and the excess tail
+            const size_t padding = alignment - page_size();
+            if (std::numeric_limits<size_t>::max() - size < padding)
+                return MAP_FAILED;
+
+            void* const raw = mmap(nullptr, size + padding, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (raw == MAP_FAILED)
+                return MAP_FAILED;
+
+            const auto raw_address = reinterpret_cast<uintptr_t>(raw);
+            const auto address     = (raw_address + alignment - 1) & ~(alignment - 1);
+
+            const size_t head = address - raw_address;
+            const size_t tail = padding - head;
+
+            if (head)
+                munmap(raw, head);
+
+            if (tail)
+                munmap(reinterpret_cast<void*>(address + size), tail);
+
+            return reinterpret_cast<void*>(address);
+        }
+#endif
+
+    public:
+        [[nodiscard]] Type* allocate(const size_type n)
+        {
+            static_assert(alignof(Type) <= 4096, "Type alignment cannot exceed the page size!");
+
+            if (max_size() < n)
+                throw std::bad_array_new_length();
+
+            const size_t size = _mapped_size(n);
+
+#if EXPU_PAGE_ALLOCATOR_USES_MMAP
+            void* const result = _map(size);
+
+            if (result == MAP_FAILED)
+                throw std::bad_alloc();
+
+            _advise(result, size);
+            return static_cast<Type*>(result);
+#else
+            return static_cast<Type*>(::operator new(size, std::align_val_t{ _alignment() }));
+#endif
+        }
+
+        void deallocate(Type* const ptr, const size_type n) noexcept
+        {
+#if EXPU_PAGE_ALLOCATOR_USES_MMAP
+            munmap(ptr, _mapped_size(n));
+#else
+            ::operator delete(ptr, _mapped_size(n), std::align_val_t{ _alignment() });
+#endif
+        }
+
+#ifdef __linux__
+    public: //Allocator extensions (see expu::_alloc_can_try_expand and expu::_alloc_can_reallocate)
+        [[nodiscard]] bool try_expand(Type* const ptr, const size_type n, const size_type new_n) noexcept
+        {
+            const size_t old_size = _mapped_size(n);
+            const size_t new_size = _mapped_size(new_n);
+
+            //Block may already have enough slack in its last page
+            if (new_size <= old_size)
+                return true;
+
+            if (max_size() < new_n)
+                return false;
+
+            //Note: Expanding in place preserves alignment
+            if (mremap(ptr, old_size, new_size, 0) == MAP_FAILED)
+                return false;
+
+            _advise(ptr, new_size);
+            return true;
+        }
+
+        [[nodiscard]] Type* reallocate(Type* const ptr, const size_type n, const size_type new_n)
+        {
+            if (max_size() < new_n)
+                throw std::bad_array_new_length();
+
+            const size_t old_size = _mapped_size(n);
+            const size_t new_size = _mapped_size(new_n);
+
+            void* result = MAP_FAILED;
+
+            if (_alignment() <= page_size())
+                result = mremap(ptr, old_size, new_size, MREMAP_MAYMOVE);
+            else {
+                //The kernel only guarantees page alignment, hence pages are moved into an aligned mapping
+                void* const target = _map(new_size);
+                if (target == MAP_FAILED)
+                    throw std::bad_alloc();
+
+                result = mremap(ptr, old_size, new_size, MREMAP_MAYMOVE | MREMAP_FIXED, target);
+
+                if (result == MAP_FAILED)
+                    munmap(target, new_size);
+            }
+
+            if (result == MAP_FAILED)
+                throw std::bad_alloc();
+
+            _advise(result, new_size);
+            return static_cast<Type*>(result);
+        }
+#endif // __linux__
+
+    public:
+        [[nodiscard]] constexpr size_type max_size() const noexcept
+        {
+            return static_cast<size_type>(std::numeric_limits<difference_type>::max()) / sizeof(Type);
+        }
+    };
+
+    template<class Type, class OtherType, size_t Alignment, bool HugePages>
+    [[nodiscard]] constexpr bool operator==(
+        const _page_allocator<Type, Alignment, HugePages>&,
+        const _page_allocator<OtherType, Alignment, HugePages>&) noexcept
+    {
+        return true;
+    }
+
+    template<class Type> using page_allocator = _page_allocator<Type, 0, false>;
+
+    //Blocks are aligned to atleast Alignment bytes (e.g. 64 for cache lines, 2MB for huge pages).
+    template<class Type, size_t Alignment> using aligned_page_allocator = _page_allocator<Type, Alignment, false>;
+
+    //Blocks are aligned to, and consist of whole, huge pages, advised to be backed by transparent huge pages.
+    template<class Type> using huge_page_allocator = _page_allocator<Type, huge_page_size, true>;
+}
+
+#undef EXPU_PAGE_ALLOCATOR_USES_MMAP
+
+#endif // !EXPU_PAGE_ALLOCATOR_HPP_INCLUDED
@@ -0,0 +1,274 @@
+#ifndef EXPU_POOL_ALLOCATOR_HPP_INCLUDED
+#define EXPU_POOL_ALLOCATOR_HPP_INCLUDED
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace expu {
+
+    //Largest block served from the pool, larger blocks are allocated through ::operator new.
+    inline constexpr size_t pool_max_block_size = 4096;
+
+    inline constexpr size_t _pool_min_block_size = 16;
+    inline constexpr size_t _pool_slab_size      = size_t(1) << 16;
+    inline constexpr size_t _pool_class_count    = std::bit_width(pool_max_block_size) - std::bit_width(_pool_min_block_size) + 1;
+
+    //Size classes are powers of 2, from _pool_min_block_size up to pool_max_block_size.
+    [[nodiscard]] constexpr size_t _pool_class_index(const size_t bytes) noexcept
+    {
+        return static_cast<size_t>(std::bit_width(std::max(bytes, _pool_min_block_size) - 1) - std::bit_width(_pool_min_block_size - 1));
+    }
+
+    [[nodiscard]] constexpr size_t _pool_class_size(const size_t index) noexcept
+    {
+        return _pool_min_block_size << index;
+    }
+
+    struct _pool_block
+    {
+        _pool_block* next;
+    };
+
+    class _pool_cache;
+
+    //Slabs are aligned to their size, hence the header of a block's slab is found by masking its address.
+    struct _pool_slab_header
+    {
+        _pool_cache* owner;
+    };
+
+    //Per-thread free lists, one per size class. Blocks freed by the owning thread are pushed onto the local list,
+    //whereas blocks freed by other threads are pushed onto the lock-free remote list, which is only drained by
+    //the owner once its local list runs dry.
+    //Note: Caches are never destroyed, when a thread exits its cache is abandoned, to be adopted by a new thread.
+    //This keeps remote frees of blocks outliving their allocating thread valid.
+    class _pool_cache
+    {
+    private:
+        struct alignas(64) _size_class
+        {
+            _pool_block* free     = nullptr;
+            char*        bump     = nullptr; //Next uncarved block of the current slab.
+            char*        bump_end = nullptr;
+
+            //Note: Separate cache line, as it is written to by other threads
+            alignas(64) std::atomic<_pool_block*> remote = nullptr;
+        };
+
+    private:
+        [[nodiscard]] static _pool_slab_header* _slab_of(void* const ptr) noexcept
+        {
+            return reinterpret_cast<_pool_slab_header*>(reinterpret_cast<uintptr_t>(ptr) & ~(_pool_slab_size - 1));
+        }
+
+        //Carves blocks out of a new slab, the first block lies at an offset aligned to the block size.
+        void _new_slab(_size_class& size_class, const size_t block_size)
+        {
+            char* const slab = static_cast<char*>(::operator new(_pool_slab_size, std::align_val_t{ _pool_slab_size }));
+            reinterpret_cast<_pool_slab_header*>(slab)->owner = this;
+
+            size_class.bump     = slab + std::max<size_t>(block_size, 64);
+            size_class.bump_end = slab + _pool_slab_size;
+        }
+
+    public:
+        [[nodiscard]] void* allocate(const size_t index)
+        {
+            _size_class& size_class = _classes[index];
+
+            if (!size_class.free)
+                size_class.free = size_class.remote.exchange(nullptr, std::memory_order_acquire);
+
+            if (_pool_block* const block = size_class.free) {
+                size_class.free = block->next;
+                return block;
+            }
+
+            const size_t block_size = _pool_class_size(index);
+
+            if (size_class.bump == size_class.bump_end)
+                _new_slab(size_class, block_size);
+
+            void* const block = size_class.bump;
+            size_class.bump += block_size;
+
+            return block;
+        }
+
+        void deallocate(void* const ptr, const size_t index) noexcept
+        {
+            if (_slab_of(ptr)->owner == this) {
+                _pool_block* const block = static_cast<_pool_block*>(ptr);
+                _size_class& size_class = _classes[index];
+
+                block->next = size_class.free;
+                size_class.free = block;
+            }
+            else
+                deallocate_remote(ptr, index);
+        }
+
+        //Pushes the block onto the remote list of its slab's owner, hence is safe from any thread, with or without a cache.
+        static void deallocate_remote(void* const ptr, const size_t index) noexcept
+        {
+            _pool_block* const block = static_cast<_pool_block*>(ptr);
+            std::atomic<_pool_block*>& remote = _slab_of(ptr)->owner->_classes[index].remote;
+
+            block->next = remote.load(std::memory_order_relaxed);
+            while (!remote.compare_exchange_weak(block->next, block, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+    private:
+        _size_class _classes[_pool_class_count];
+    };
+
+    class _pool_registry
+    {
+    public:
+        //Note: Never destroyed, such that blocks may still be freed during static destruction
+        [[nodiscard]] static _pool_registry& instance()
+        {
+            static _pool_registry* const registry = new _pool_registry();
+            return *registry;
+        }
+
+    public:
+        [[nodiscard]] _pool_cache* acquire()
+        {
+            const std::lock_guard lock(_mutex);
+
+            if (_abandoned.empty())
+                return new _pool_cache();
+
+            _pool_cache* const cache = _abandoned.back();
+            _abandoned.pop_back();
+
+            return cache;
+        }
+
+        void abandon(_pool_cache* const cache)
+        {
+            const std::lock_guard lock(_mutex);
+            _abandoned.push_back(cache);
+        }
+
+    private:
+        std::mutex _mutex;
+        std::vector<_pool_cache*> _abandoned;
+    };
+
+    //Cache of the calling thread, null before its first pooled allocation and once the thread has abandoned it.
+    //Note: Trivially destructible, hence still valid while other thread_local objects (e.g. containers allocated
+    //from the pool) are destroyed after the cache was abandoned.
+    inline constinit thread_local _pool_cache* _this_thread_pool_cache_ptr = nullptr;
+
+    //Abandons the calling thread's cache when it exits
+    struct _pool_thread_cache_owner
+    {
+        ~_pool_thread_cache_owner()
+        {
+            _pool_registry::instance().abandon(std::exchange(_this_thread_pool_cache_ptr, nullptr));
+        }
+    };
+
+    //Cache of the calling thread, from which blocks are allocated.
+    //Note: Threads allocating after their cache was abandoned (e.g. during static destruction) acquire another,
+    //which is then never abandoned, as its owner cannot be constructed again.
+    [[nodiscard]] inline _pool_cache& _this_thread_pool_cache()
+    {
+        if (!_this_thread_pool_cache_ptr) {
+            _this_thread_pool_cache_ptr = _pool_registry::instance().acquire();
+
+            thread_local _pool_thread_cache_owner owner;
+        }
+
+        return *_this_thread_pool_cache_ptr;
+    }
+
+    //Frees a pooled block from the calling thread.
+    //Note: Once the thread's cache has been abandoned, it may already be adopted by another thread, hence blocks
+    //are only pushed onto the lock-free remote lists.
+    inline void _pool_deallocate(void* const ptr, const size_t index) noexcept
+    {
+        if (_pool_cache* const cache = _this_thread_pool_cache_ptr)
+            cache->deallocate(ptr, index);
+        else
+            _pool_cache::deallocate_remote(ptr, index);
+    }
+
+    //Stateless allocator serving blocks of upto pool_max_block_size bytes from per-thread, per-size-class free
+    //lists, avoiding contention on the global heap. Blocks may be freed from any thread.
+    //Note: Memory is retained by the pool for reuse, rather than being returned to the system.
+    template<class Type>
+    class pool_allocator
+    {
+    public:
+        using value_type      = Type;
+        using size_type       = size_t;
+        using difference_type = ptrdiff_t;
+
+        using is_always_equal                        = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+
+    public:
+        constexpr pool_allocator() noexcept = default;
+
+        template<class OtherType>
+        constexpr pool_allocator(const pool_allocator<OtherType>&) noexcept {}
+
+    private:
+        //Note: Blocks are aligned to their (power of 2) size, hence to alignof(Type)
+        [[nodiscard]] static constexpr bool _is_pooled(const size_t bytes) noexcept
+        {
+            return bytes <= pool_max_block_size && alignof(Type) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+        }
+
+    public:
+        [[nodiscard]] Type* allocate(const size_type n)
+        {
+            if (max_size() < n)
+                throw std::bad_array_new_length();
+
+            const size_t bytes = n * sizeof(Type);
+
+            if (_is_pooled(bytes))
+                return static_cast<Type*>(_this_thread_pool_cache().allocate(_pool_class_index(bytes)));
+            else
+                return static_cast<Type*>(::operator new(bytes, std::align_val_t{ alignof(Type) }));
+        }
+
+        void deallocate(Type* const ptr, const size_type n) noexcept
+        {
+            const size_t bytes = n * sizeof(Type);
+
+            if (_is_pooled(bytes))
+                _pool_deallocate(ptr, _pool_class_index(bytes));
+            else
+                ::operator delete(ptr, bytes, std::align_val_t{ alignof(Type) });
+        }
+
+    public:
+        [[nodiscard]] constexpr size_type max_size() const noexcept
+        {
+            return static_cast<size_type>(std::numeric_limits<difference_type>::max()) / sizeof(Type);
+        }
+    };
+
+    template<class Type, class OtherType>
+    [[nodiscard]] constexpr bool operator==(const pool_allocator<Type>&, const pool_allocator<OtherType>&) noexcept
+    {
+        return true;
+    }
+}
+
+#endif // !EXPU_POOL_ALLOCATOR_HPP_INCLUDED
@@ -0,0 +1,332 @@
+#ifndef EXPU_ADAPTIVE_MAP_HPP_INCLUDED
+#define EXPU_ADAPTIVE_MAP_HPP_INCLUDED
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "expu/debug.hpp"
+#include "expu/maths/hash_utils.hpp"
+#include "expu/containers/linear_map.hpp"
+
+namespace expu {
+
+    //Unordered map storing its elements as a linear_map does (one sequence of key and mapped value pairs, scanned
+    //by expu::_linear_find), until it holds more than Threshold of them. It then builds a hash index over that same
+    //sequence: a linearly probed table of element positions, which lookups follow instead of scanning. The index is
+    //released again once the map shrinks to half the threshold, hence maps which stay small never pay for hashing.
+    //Note: Erasing an element moves the last element into its position, so that positions in the index need only
+    //be updated for that one element.
+    template<
+        class KeyType,
+        class MappedType,
+        size_t Threshold = 16,
+        class Hash       = std::hash<KeyType>,
+        class KeyEqual   = std::equal_to<KeyType>,
+        class Container  = std::vector<std::pair<KeyType, MappedType>>>
+    class adaptive_map
+    {
+    public: //Typedefs
+        using key_type        = KeyType;
+        using mapped_type     = MappedType;
+        using hasher          = Hash;
+        using key_equal       = KeyEqual;
+        using value_type      = typename Container::value_type;
+        using size_type       = typename Container::size_type;
+        using difference_type = typename Container::difference_type;
+        using iterator        = typename Container::iterator;
+        using const_iterator  = typename Container::const_iterator;
+
+        static_assert(std::is_same_v<value_type, std::pair<KeyType, MappedType>>, "Container must be of type std::pair");
+
+        static constexpr size_type threshold = Threshold;
+
+    private:
+        //Slots of the index hold the position of an element plus one, empty slots hold zero
+        using _index_t = std::vector<size_type>;
+
+        static constexpr size_type _empty_slot = 0;
+
+    public: //Constructors
+        constexpr adaptive_map() = default;
+
+        template<class ... Args>
+        requires std::is_constructible_v<Container, Args...>
+        constexpr explicit adaptive_map(Args&& ... args):
+            _elements(std::forward<Args>(args)...) {}
+
+        //Note: Later duplicates of a key are ignored
+        constexpr adaptive_map(const std::initializer_list<value_type> elements)
+        {
+            for (const value_type& element : elements)
+                try_emplace(element.first, element.second);
+        }
+
+    public: //Lookup
+        [[nodiscard]] constexpr const_iterator find(const key_type& key) const
+        {
+            //Note: Safe to do since find is a const function
+            return const_cast<adaptive_map&>(*this).find(key);
+        }
+
+        [[nodiscard]] constexpr iterator find(const key_type& key)
+        {
+            if (!hashed())
+                return _linear_find<key_equal>(_elements, key);
+
+            for (size_type slot = _home(key); _index[slot] != _empty_slot; slot = _next(slot)) {
+                const iterator element = _at(_index[slot] - 1);
+
+                if (key_equal()(element->first, key))
+                    return element;
+            }
+
+            return end();
+        }
+
+        [[nodiscard]] constexpr bool contains(const key_type& key) const
+        {
+            return find(key) != end();
+        }
+
+    public: // Indexing functions
+        [[nodiscard]] constexpr const mapped_type& at(const key_type& key) const
+        {
+            const const_iterator loc = find(key);
+
+            if (loc == cend())
+                throw std::out_of_range("Key not found!");
+            else
+                return loc->second;
+        }
+
+        [[nodiscard]] constexpr mapped_type& at(const key_type& key)
+        {
+            return const_cast<mapped_type&>(static_cast<const adaptive_map&>(*this).at(key));
+        }
+
+        [[nodiscard]] constexpr const mapped_type& operator[](const key_type& key) const
+        {
+            const const_iterator loc = find(key);
+            EXPU_VERIFY_DEBUG(loc != cend(), "Key not found!");
+
+            return loc->second;
+        }
+
+        constexpr mapped_type& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+
+    public: //Insertion functions
+        //Constructs the mapped value from args if the key is not present, returning the element and whether it was inserted.
+        template<class ... Args>
+        constexpr std::pair<iterator, bool> try_emplace(const key_type& key, Args&& ... args)
+        {
+            size_type slot = 0;
+
+            if (!hashed()) {
+                if (const iterator loc = _linear_find<key_equal>(_elements, key); loc != end())
+                    return { loc, false };
+            }
+            else {
+                for (slot = _home(key); _index[slot] != _empty_slot; slot = _next(slot)) {
+                    const iterator element = _at(_index[slot] - 1);
+
+                    if (key_equal()(element->first, key))
+                        return { element, false };
+                }
+            }
+
+            //Note: The standard does not require that a SequentialContainer's
+            //emplace_back return anything, unlike emplace
+            _elements.emplace(cend(), std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+
+            try {
+                //Note: Keeps the index at most half full
+                if (hashed() ? _index.size() < 2 * size() : threshold < size())
+                    _rebuild_index(_index_capacity(size()));
+                else if (hashed())
+                    _index[slot] = size();
+            }
+            catch (...) {
+                _elements.erase(std::prev(cend()));
+                throw;
+            }
+
+            return { std::prev(end()), true };
+        }
+
+    public: //Erasion functions
+        constexpr void erase(const key_type& key)
+        {
+            if (!hashed()) {
+                if (const iterator loc = _linear_find<key_equal>(_elements, key); loc != end())
+                    _erase_at(static_cast<size_type>(loc - begin()));
+
+                return;
+            }
+
+            size_type slot = _home(key);
+            for (; _index[slot] != _empty_slot; slot = _next(slot))
+                if (key_equal()(_at(_index[slot] - 1)->first, key))
+                    break;
+
+            if (_index[slot] == _empty_slot)
+                return;
+
+            const size_type position = _index[slot] - 1;
+            const size_type last     = size() - 1;
+
+            //The last element takes the erased element's position, hence its slot must point there instead
+            if (position != last) {
+                size_type last_slot = _home(_at(last)->first);
+                while (_index[last_slot] != last + 1)
+                    last_slot = _next(last_slot);
+
+                _index[last_slot] = position + 1;
+            }
+
+            _erase_at(position);
+            _unindex(slot);
+
+            if (size() <= threshold / 2)
+                _index_t().swap(_index);
+        }
+
+    public: //Comparison operators
+        //Note: Elements' positions depend on the history of insertions and erasions, hence are not compared
+        [[nodiscard]] constexpr bool operator==(const adaptive_map& other) const
+        {
+            return size() == other.size() && std::ranges::all_of(_elements, [&](const value_type& element) {
+                const const_iterator loc = other.find(element.first);
+                return loc != other.end() && loc->second == element.second;
+            });
+        }
+
+    public:
+        constexpr void swap(adaptive_map& other)
+            noexcept(std::is_nothrow_swappable_v<Container>)
+        {
+            using std::swap;
+
+            swap(_elements, other._elements);
+            _index.swap(other._index);
+        }
+
+    public: //Size getters
+        [[nodiscard]] constexpr size_type size()  const noexcept { return static_cast<size_type>(_elements.size()); }
+        [[nodiscard]] constexpr bool      empty() const noexcept { return _elements.empty(); }
+
+        //Whether lookups go through the hash index rather than scanning the elements
+        [[nodiscard]] constexpr bool hashed() const noexcept { return !_index.empty(); }
+
+    public: //Iterator getters
+        [[nodiscard]] constexpr iterator begin() noexcept { return _elements.begin(); }
+        [[nodiscard]] constexpr iterator end()   noexcept { return _elements.end();   }
+
+        [[nodiscard]] constexpr const_iterator begin()  const noexcept { return _elements.cbegin(); }
+        [[nodiscard]] constexpr const_iterator end()    const noexcept { return _elements.cend();   }
+        [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return _elements.cbegin(); }
+        [[nodiscard]] constexpr const_iterator cend()   const noexcept { return _elements.cend();   }
+
+    private: //Index helpers
+        [[nodiscard]] constexpr iterator _at(const size_type position) noexcept
+        {
+            return begin() + static_cast<difference_type>(position);
+        }
+
+        [[nodiscard]] constexpr size_type _mask() const noexcept { return _index.size() - 1; }
+
+        [[nodiscard]] constexpr size_type _home(const key_type& key) const
+        {
+            return static_cast<size_type>(_mix_hash(hasher()(key))) & _mask();
+        }
+
+        [[nodiscard]] constexpr size_type _next(const size_type slot) const noexcept
+        {
+            return (slot + 1) & _mask();
+        }
+
+        //Smallest power of two capacity keeping the index of size elements at most a quarter full, leaving room to grow
+        [[nodiscard]] static constexpr size_type _index_capacity(const size_type size) noexcept
+        {
+            return std::bit_ceil(std::max<size_type>(4 * size, 16));
+        }
+
+        //Note: Provides the strong guarantee
+        constexpr void _rebuild_index(const size_type capacity)
+        {
+            EXPU_VERIFY_DEBUG(std::has_single_bit(capacity), "Index capacity must be a power of two!");
+
+            _index_t index(capacity, _empty_slot);
+            index.swap(_index);
+
+            try {
+                for (size_type position = 0; position != size(); ++position) {
+                    size_type slot = _home(_at(position)->first);
+                    while (_index[slot] != _empty_slot)
+                        slot = _next(slot);
+
+                    _index[slot] = position + 1;
+                }
+            }
+            catch (...) {
+                index.swap(_index);
+                throw;
+            }
+        }
+
+        //Empties the given slot, shifting back any later slots of its probe run which may then be reached sooner.
+        //Note: Keeps probe runs free of holes without tombstones, hence lookups of missing keys stop at the first empty slot
+        constexpr void _unindex(size_type hole)
+        {
+            for (size_type slot = _next(hole); _index[slot] != _empty_slot; slot = _next(slot)) {
+                const size_type home = _home(_at(_index[slot] - 1)->first);
+
+                //Moves the slot's element into the hole unless its home lies after the hole, within the run
+                if (((slot - home) & _mask()) >= ((slot - hole) & _mask())) {
+                    _index[hole] = _index[slot];
+                    hole = slot;
+                }
+            }
+
+            _index[hole] = _empty_slot;
+        }
+
+        //Erases the element at position by moving the last element into it
+        constexpr void _erase_at(const size_type position)
+        {
+            const iterator last = std::prev(end());
+
+            if (_at(position) != last)
+                *_at(position) = std::move(*last);
+
+            _elements.erase(last);
+        }
+
+    private:
+        Container _elements;
+        _index_t  _index;
+    };
+
+    //Note: template_of cannot match adaptive_map, as its threshold is not a type
+    template<class KeyType, class MappedType, size_t Threshold, class Hash, class KeyEqual, class Container>
+    constexpr void swap(
+        adaptive_map<KeyType, MappedType, Threshold, Hash, KeyEqual, Container>& lhs,
+        adaptive_map<KeyType, MappedType, Threshold, Hash, KeyEqual, Container>& rhs)
+        noexcept(noexcept(lhs.swap(rhs)))
+    {
+        lhs.swap(rhs);
+    }
+}
+
+#endif // !EXPU_ADAPTIVE_MAP_HPP_INCLUDED
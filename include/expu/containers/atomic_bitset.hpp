@@ -0,0 +1,138 @@
+#ifndef EXPU_ATOMIC_BITSET_HPP_INCLUDED
+#define EXPU_ATOMIC_BITSET_HPP_INCLUDED
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "expu/containers/fixed_array.hpp"
+
+#include "expu/maths/bit_utils.hpp"
+
+namespace expu {
+
+    //Fixed size array of bools which may be read and modified concurrently by several threads, e.g. marking
+    //visited vertices during a parallel graph traversal. Each element is modified by a single atomic fetch_or or
+    //fetch_and on its word, hence threads modifying neighbouring elements never lose each other's writes.
+    //Bulk operations (snapshot, merge, release) are not atomic, they must not overlap with any other access,
+    //e.g. being called between phases of a traversal.
+    template<class Alloc = std::allocator<bool>>
+    class atomic_bitset
+    {
+    public:
+        using size_type      = size_t;
+        using value_type     = bool;
+        using allocator_type = Alloc;
+
+    private:
+        using _atomic_word = std::atomic_ref<_bit_word>;
+
+        static_assert(alignof(_bit_word) >= _atomic_word::required_alignment);
+
+    public:
+        explicit atomic_bitset(const size_type size, const bool value = false, const Alloc& alloc = Alloc()):
+            _bits(size, value, alloc) {}
+
+        explicit atomic_bitset(fixed_array<bool, Alloc> bits) noexcept:
+            _bits(std::move(bits)) {}
+
+        //Note: Not atomic, as with the other bulk operations
+        atomic_bitset(const atomic_bitset& other) = default;
+        atomic_bitset(atomic_bitset&& other) noexcept = default;
+
+        atomic_bitset& operator=(const atomic_bitset& other) = default;
+        atomic_bitset& operator=(atomic_bitset&& other) noexcept = default;
+
+    private:
+        [[nodiscard]] _atomic_word _word_of(const size_type pos) const noexcept
+        {
+            EXPU_VERIFY_DEBUG(pos < size(), "Index out of range!");
+
+            //Note: Words are never const objects, only viewed as const through const members
+            return _atomic_word(const_cast<_bit_word&>(_bits.begin()._word()[pos >> _bit_word_shift]));
+        }
+
+        [[nodiscard]] static constexpr _bit_word _mask_of(const size_type pos) noexcept
+        {
+            return _bit_word(1) << (pos & (_bit_word_bits - 1));
+        }
+
+    public:
+        [[nodiscard]] bool test(const size_type pos, const std::memory_order order = std::memory_order_seq_cst) const noexcept
+        {
+            return _word_of(pos).load(order) & _mask_of(pos);
+        }
+
+        [[nodiscard]] bool operator[](const size_type pos) const noexcept { return test(pos); }
+
+        //Sets the element, returning its previous value. Exactly one of the threads concurrently setting an
+        //unset element observes false.
+        bool test_and_set(const size_type pos, const std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return _word_of(pos).fetch_or(_mask_of(pos), order) & _mask_of(pos);
+        }
+
+        //Resets the element, returning its previous value.
+        bool test_and_reset(const size_type pos, const std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return _word_of(pos).fetch_and(~_mask_of(pos), order) & _mask_of(pos);
+        }
+
+        void set(const size_type pos, const std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            (void)test_and_set(pos, order);
+        }
+
+        void reset(const size_type pos, const std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            (void)test_and_reset(pos, order);
+        }
+
+        //Number of set elements. Each word is loaded atomically, though words set concurrently with the count
+        //may or may not be counted.
+        [[nodiscard]] size_type count(const std::memory_order order = std::memory_order_seq_cst) const noexcept
+        {
+            size_type result = 0;
+
+            for (size_type index = 0; index != _bit_word_count(size()); ++index)
+                result += static_cast<size_type>(std::popcount(_word_of(index << _bit_word_shift).load(order)));
+
+            return result;
+        }
+
+    public:
+        //Non-atomic copy of the elements.
+        [[nodiscard]] fixed_array<bool, Alloc> snapshot() const
+        {
+            return _bits;
+        }
+
+        //Non-atomically sets every element set in other.
+        atomic_bitset& merge(const fixed_array<bool, Alloc>& other) noexcept
+        {
+            _bits |= other;
+            return *this;
+        }
+
+        atomic_bitset& merge(const atomic_bitset& other) noexcept
+        {
+            return merge(other._bits);
+        }
+
+        //Moves the elements out as a plain fixed_array<bool>, leaving the bitset empty.
+        [[nodiscard]] fixed_array<bool, Alloc> release() noexcept
+        {
+            return std::move(_bits);
+        }
+
+    public:
+        [[nodiscard]] size_type size() const noexcept { return _bits.size(); }
+
+    private:
+        fixed_array<bool, Alloc> _bits;
+    };
+}
+
+#endif // !EXPU_ATOMIC_BITSET_HPP_INCLUDED
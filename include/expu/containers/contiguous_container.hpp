@@ -1,7 +1,10 @@
 #ifndef CONTIGUOUS_CONTAINER_HPP_INCLUDED
 #define CONTIGUOUS_CONTAINER_HPP_INCLUDED
 
+#include <algorithm>
+#include <bit>
 #include <iterator>
+#include <memory>
 #include <type_traits>
 
 #include "expu/debug.hpp"
@@ -9,6 +12,7 @@
 #include "expu/meta/meta_utils.hpp"
 
 #include "expu/maths/basic_maths.hpp"
+#include "expu/maths/bit_utils.hpp"
 
 #if EXPU_ITERATOR_DEBUG_LEVEL > 0
 #define EXPU_L1_ITER_VERIFY(condition, message) \
@@ -296,10 +300,10 @@ namespace expu {
         friend struct _ctg_bool_const_iterator;
 
     public:
-        constexpr _const_bool_index(void* const ptr, uint8_t sub_index) :
-            _ptr(static_cast<uint8_t*>(ptr)), _mask(1 << sub_index)
+        constexpr _const_bool_index(_bit_word* const ptr, const size_t sub_index) :
+            _ptr(ptr), _mask(_bit_word(1) << sub_index)
         {
-            EXPU_VERIFY_DEBUG(sub_index < 8, "Index is too large!");
+            EXPU_VERIFY_DEBUG(sub_index < _bit_word_bits, "Index is too large!");
         }
 
     public:
@@ -308,8 +312,8 @@ namespace expu {
             return static_cast<bool>(*_ptr & _mask);
         }
     protected:
-        uint8_t* _ptr;
-        uint8_t _mask;
+        _bit_word* _ptr;
+        _bit_word  _mask;
     };
 
     class _bool_index : public _const_bool_index
@@ -318,18 +322,21 @@ namespace expu {
     public:
         using _const_bool_index::_const_bool_index;
 
+        constexpr _bool_index(const _bool_index&) = default;
+
     public:
         constexpr _bool_index& operator=(bool value) noexcept
         {
-            //Todo: perhaps remove branch
-            if (value)
-                *_const_bool_index::_ptr |= _const_bool_index::_mask;
-            else
-                *_const_bool_index::_ptr &= ~_const_bool_index::_mask;
-
+            //Note: Branchless, -value is either all or no bits set
+            *_ptr = (*_ptr & ~_mask) | (_mask & (_bit_word(0) - value));
             return *this;
         }
 
+        //Note: Assigns the referenced bit, rather than rebinding the reference (as with std::vector<bool>::reference)
+        constexpr _bool_index& operator=(const _bool_index& other) noexcept
+        {
+            return this->operator=(static_cast<bool>(other));
+        }
     };
 
 
@@ -353,10 +360,22 @@ namespace expu {
             _index(nullptr, 0) {}
 
         constexpr _ctg_bool_const_iterator(BoolRangePair::pointer ptr, const BoolRangePair* data) :
-            _index(ptr, 0) { (void)data; }
+            _index(std::to_address(ptr), 0) { (void)data; }
 
-        constexpr _ctg_bool_const_iterator(BoolRangePair::pointer ptr, uint8_t index, const BoolRangePair* data):
-            _index(ptr, index) { (void)data; }
+        constexpr _ctg_bool_const_iterator(BoolRangePair::pointer ptr, size_t index, const BoolRangePair* data):
+            _index(std::to_address(ptr), index) { (void)data; }
+
+        constexpr _ctg_bool_const_iterator(const _ctg_bool_const_iterator&) = default;
+
+    public:
+        //Note: _bool_index assigns through, hence the position is copied member-wise
+        constexpr _ctg_bool_const_iterator& operator=(const _ctg_bool_const_iterator& other) noexcept
+        {
+            _index._ptr  = other._index._ptr;
+            _index._mask = other._index._mask;
+
+            return *this;
+        }
 
     public:
         [[nodiscard]] constexpr reference     operator*()  const noexcept { return _index; }
@@ -370,42 +389,27 @@ namespace expu {
     public:
         constexpr _ctg_bool_const_iterator& operator++() noexcept
         {
-            if (_index._mask == 0x80) {
-                ++_index._ptr;
-                _index._mask = 1;
-            }
-            else
-                _index._mask <<= 1;
+            _index._mask = std::rotl(_index._mask, 1);
+            _index._ptr += (_index._mask == 1);
 
             return *this;
         }
 
         constexpr _ctg_bool_const_iterator& operator--() noexcept
         {
-            if (_index._mask == 0x1) {
-                --_index._ptr;
-                _index._mask = 0x80;
-            }
-            else
-                _index._mask >>= 1;
+            _index._ptr -= (_index._mask == 1);
+            _index._mask = std::rotr(_index._mask, 1);
 
             return *this;
         }
 
         constexpr _ctg_bool_const_iterator& operator+=(const difference_type n) noexcept
         {
-            _index._ptr += (n >> 3);
-
-            uint16_t mask_prod = static_cast<uint16_t>(_index._mask) << (n & 7);
+            //Note: Right shifting a negative position rounds towards negative infinity
+            const difference_type position = std::countr_zero(_index._mask) + n;
 
-            if (mask_prod < 0x100) {
-                _index._mask = mask_prod & 0xFF;
-                if (n < 0) --_index._ptr;
-            }
-            else {
-                _index._mask = mask_prod >> 8;
-                if (0 < n) ++_index._ptr;
-            }
+            _index._ptr += position >> _bit_word_shift;
+            _index._mask = _bit_word(1) << (position & (_bit_word_bits - 1));
 
             return *this;
         }
@@ -425,6 +429,10 @@ namespace expu {
         }
         */
 
+    public: //Word-level access, used by bulk bit algorithms
+        [[nodiscard]] constexpr _bit_word* _word()   const noexcept { return _index._ptr; }
+        [[nodiscard]] constexpr size_t     _offset() const noexcept { return static_cast<size_t>(std::countr_zero(_index._mask)); }
+
     private: // Circumvent non-transitivity of friendship
         constexpr auto _index_ptr()  const noexcept { return _index._ptr; }
         constexpr auto _index_mask() const noexcept { return _index._mask; }
@@ -434,7 +442,8 @@ namespace expu {
             noexcept
         {
             //lhs._verify_cont_compat(rhs);
-            return static_cast<difference_type>(((lhs._index_ptr() - rhs._index_ptr()) << 3) + int_log2(lhs._index_mask()) - int_log2(rhs._index_mask()));
+            return static_cast<difference_type>((lhs._index_ptr() - rhs._index_ptr()) * static_cast<difference_type>(_bit_word_bits)) +
+                std::countr_zero(lhs._index_mask()) - std::countr_zero(rhs._index_mask());
         }
 
         [[nodiscard]] friend constexpr auto operator<=>(const _ctg_bool_const_iterator& lhs, const _ctg_bool_const_iterator& rhs)
@@ -524,6 +533,59 @@ namespace expu {
     EXPU_ITERATOR_NON_MEMBER_FUNCTIONS(_ctg_bool_const_iterator);
     EXPU_ITERATOR_NON_MEMBER_FUNCTIONS(_ctg_bool_iterator);
 
+
+    //////////////////////////////////////PACKED BOOL ALGORITHMS///////////////////////////////////////////////////////////////////////////////
+
+    //Note: std::ranges::count and std::ranges::find cannot be overloaded, hence expu::count and expu::find are
+    //provided instead, dispatching to word-level algorithms for packed bool iterators.
+
+    //Note: Iterators over wider packed values (e.g. packed_array's) also expose their words, hence the value type is checked
+    template<class Iterator>
+    concept _packed_bool_iterator = std::same_as<std::iter_value_t<Iterator>, bool> && requires(const Iterator& iter)
+    {
+        { iter._word()   } -> std::same_as<_bit_word*>;
+        { iter._offset() } -> std::same_as<size_t>;
+    };
+
+    template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel, class Type>
+    [[nodiscard]] constexpr std::iter_difference_t<InputIt> count(InputIt first, const Sentinel last, const Type& value)
+    {
+        if constexpr (_packed_bool_iterator<InputIt> && std::same_as<InputIt, Sentinel>) {
+            const auto range_size = last - first;
+            const auto set_count  = static_cast<std::iter_difference_t<InputIt>>(
+                _count_bits(first._word(), first._offset(), first._offset() + static_cast<size_t>(range_size)));
+
+            return static_cast<bool>(value) ? set_count : range_size - set_count;
+        }
+        else
+            return std::ranges::count(std::move(first), last, value);
+    }
+
+    template<std::ranges::input_range Range, class Type>
+    [[nodiscard]] constexpr std::ranges::range_difference_t<Range> count(Range&& range, const Type& value)
+    {
+        return expu::count(std::ranges::begin(range), std::ranges::end(range), value);
+    }
+
+    template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel, class Type>
+    [[nodiscard]] constexpr InputIt find(InputIt first, const Sentinel last, const Type& value)
+    {
+        if constexpr (_packed_bool_iterator<InputIt> && std::same_as<InputIt, Sentinel>) {
+            const size_t last_bit = first._offset() + static_cast<size_t>(last - first);
+            const size_t found    = _find_bit(first._word(), first._offset(), last_bit, static_cast<bool>(value));
+
+            return first + static_cast<std::iter_difference_t<InputIt>>(found - first._offset());
+        }
+        else
+            return std::ranges::find(std::move(first), last, value);
+    }
+
+    template<std::ranges::input_range Range, class Type>
+    [[nodiscard]] constexpr std::ranges::iterator_t<Range> find(Range&& range, const Type& value)
+    {
+        return expu::find(std::ranges::begin(range), std::ranges::end(range), value);
+    }
+
 }
 
 #undef EXPU_ITERATOR_NON_MEMBER_FUNCTIONS
@@ -2,10 +2,14 @@
 #define EXPU_CONTAINERS_DARRAY_HPP_INCLUDED
 
 #include <iterator>
+#include <functional>
 #include <memory>
+#include <ranges>
+#include <span>
 #include <stdexcept>
 
 #include "expu/containers/contiguous_container.hpp"
+#include "expu/containers/growth_policy.hpp"
 
 #include "expu/debug.hpp"
 #include "expu/meta/meta_utils.hpp"
@@ -36,7 +40,8 @@ namespace expu {
 
     template<
         class Type,
-        class Alloc = std::allocator<Type>>
+        class Alloc = std::allocator<Type>,
+        class GrowthPolicy = geometric_growth<>>
     class darray
     {
     private:
@@ -44,6 +49,8 @@ namespace expu {
 
         //Ensure allocator value_type matches the container type
         static_assert(std::is_same_v<Type, typename _alloc_traits::value_type>);
+        //Note: Not constrained in template parameter list, to keep darray usable with expu::template_of
+        static_assert(growth_policy<GrowthPolicy>, "GrowthPolicy must satisfy expu::growth_policy!");
 
     //Essential typedefs (Container requirements)
     public:
@@ -59,6 +66,9 @@ namespace expu {
     private:
         using _data_t = _darray_data<pointer, const_pointer>;
 
+    public:
+        using growth_policy_type = GrowthPolicy;
+
     //Iterator typedefs
     public:
         using iterator       = ctg_iterator<_data_t>;
@@ -165,6 +175,15 @@ namespace expu {
             _data().end   = new_first + new_capacity;
         }
 
+        //As _replace, but the elements of the internal array have already been relocated, hence
+        //are only deallocated.
+        constexpr void _replace_relocated(const pointer new_first, const pointer new_last, const size_type new_capacity)
+            noexcept
+        {
+            _data().last = _data().first;
+            _replace(new_first, new_last, new_capacity);
+        }
+
     private: //Helper assign functions
         template<
             std::input_iterator InputIt,
@@ -198,8 +217,15 @@ namespace expu {
             std::sentinel_for<FwdIt> Sentinel>
         constexpr darray& _alt_alloc_assign(Alloc& alt_alloc, FwdIt first, const Sentinel last)
         {
-            const size_type range_size = static_cast<size_type>(std::ranges::distance(first, last));
+            return _alt_alloc_assign(alt_alloc, first, last, static_cast<size_type>(std::ranges::distance(first, last)));
+        }
 
+        //As above, but range_size (the distance between first and last) is already known.
+        template<
+            std::forward_iterator FwdIt,
+            std::sentinel_for<FwdIt> Sentinel>
+        constexpr darray& _alt_alloc_assign(Alloc& alt_alloc, FwdIt first, const Sentinel last, const size_type range_size)
+        {
             //Case 1: Not enough capacity to fit new range, resize.
             if (capacity() < range_size) {
                 _resize_assign(alt_alloc, first, last, range_size);
@@ -250,20 +276,22 @@ namespace expu {
         {
             if constexpr (_alloc_traits::propagate_on_container_copy_assignment::value) {
                 if constexpr (!_alloc_traits::is_always_equal::value) {
+                    //Note: Memory cannot be deallocated by other's allocator, hence it is released before propagating
                     if (_alloc() != other._alloc()) {
-                        _alt_alloc_assign(other._alloc(), other._data().first, other._data().last);
-                        _alloc() = other._alloc();
-                        return *this;
+                        _clear_dealloc();
+                        _data() = _data_t{ nullptr, nullptr, nullptr };
                     }
                 }
 
                 _alloc() = other._alloc();
             }
 
-            return assign(other._data().first, other._data().end);
+            return assign(other._data().first, other._data().last);
         }
 
-        constexpr darray& operator=(darray&& other) noexcept
+        //Note: Allocators which neither propagate nor always compare equal may require elements to be moved one by one
+        constexpr darray& operator=(darray&& other)
+            noexcept(_alloc_traits::propagate_on_container_move_assignment::value || _alloc_traits::is_always_equal::value)
         {
             if constexpr (!_alloc_traits::propagate_on_container_move_assignment::value) {
                 if constexpr (!_alloc_traits::is_always_equal::value) {
@@ -285,13 +313,35 @@ namespace expu {
         }
 
     public:
-        constexpr void erase(const const_iterator first, const const_iterator last)
-            noexcept(std::is_nothrow_destructible_v<value_type>)
+        constexpr iterator erase(const const_iterator first, const const_iterator last)
+            noexcept(is_trivially_relocatable_v<value_type> || std::is_nothrow_move_assignable_v<value_type>)
         {
-            auto& naked_first = first._unwrapped();
+            const pointer naked_first = first._unwrapped();
+            const pointer naked_last  = last._unwrapped();
+
+            EXPU_VERIFY_DEBUG((_data().first <= naked_first) && (naked_first <= naked_last) && (naked_last <= _data().last),
+                "Erase range does not lie within constructed range of the array!");
+
+            if (naked_first != naked_last) {
+                if constexpr (is_trivially_relocatable_v<value_type>) {
+                    destroy_range(_alloc(), naked_first, naked_last);
+                    _data().last = uninitialised_relocate(_alloc(), naked_last, _data().last, naked_first);
+                }
+                else {
+                    const pointer new_last = move(naked_last, _data().last, naked_first);
+                    destroy_range(_alloc(), new_last, _data().last);
+
+                    _data().last = new_last;
+                }
+            }
 
-            destroy_range(_alloc(), naked_first, last._unwrapped());
-            _data().last = naked_first;
+            return iterator(naked_first, &_data());
+        }
+
+        constexpr iterator erase(const const_iterator at)
+            noexcept(noexcept(erase(at, at)))
+        {
+            return erase(at, std::next(at));
         }
 
     public:
@@ -330,6 +380,21 @@ namespace expu {
             if (_data().last != _data().end) {
                 if (naked_at == _data().last)
                     u_emplace_back(std::forward<Args>(args)...);
+                //Shift tail by one with a single memmove, then construct into the gap.
+                else if constexpr (is_trivially_relocatable_v<value_type>) {
+                    const pointer new_last = uninitialised_relocate(_alloc(), naked_at, _data().last, naked_at + 1);
+
+                    try {
+                        _alloc_traits::construct(_alloc(), std::to_address(naked_at), std::forward<Args>(args)...);
+                    }
+                    catch (...) {
+                        //Provide strong guarantee
+                        uninitialised_relocate(_alloc(), naked_at + 1, new_last, naked_at);
+                        throw;
+                    }
+
+                    _data().last = new_last;
+                }
                 else {
                     const pointer before_last = std::prev(_data().last);
 
@@ -372,6 +437,11 @@ namespace expu {
             else {
                 const size_type new_capacity = _calculate_growth(capacity() + 1);
 
+                //Note: Block may only be moved if none of the arguments refer to the elements of this array.
+                const difference_type at_index = naked_at - _data().first;
+                if (_try_grow_without_copy(new_capacity, !(_owns_address(std::addressof(args)) || ...)))
+                    return emplace(cbegin() + at_index, std::forward<Args>(args)...);
+
                 const pointer new_first    = _alloc_traits::allocate(_alloc(), new_capacity);
                 const pointer construct_at = new_first + (naked_at - _data().first);
                       pointer new_last     = new_first;
@@ -386,6 +456,14 @@ namespace expu {
                     throw;
                 }
 
+                if constexpr (is_trivially_relocatable_v<value_type>) {
+                    uninitialised_relocate(_alloc(), _data().first, naked_at, new_first);
+                    new_last = uninitialised_relocate(_alloc(), naked_at, _data().last, construct_at + 1);
+
+                    _replace_relocated(new_first, new_last, new_capacity);
+                    return iterator(construct_at, &_data());
+                }
+
                 try {
                     if (naked_at == _data().last) {
                         new_last = _reversible_uninitialised_move(_data().first, _data().last, new_first);
@@ -414,7 +492,13 @@ namespace expu {
         template<class ... Args>
         constexpr iterator emplace_back(Args&& ... args)
         {
-            return emplace(cend(), std::forward<Args>(args)...);
+            //Note: Keeps the common case small enough to be inlined, apart from emplace's growth path
+            if (_data().last != _data().end) {
+                u_emplace_back(std::forward<Args>(args)...);
+                return iterator(std::prev(_data().last), &_data());
+            }
+            else
+                return emplace(cend(), std::forward<Args>(args)...);
         }
 
         constexpr void push_back(const value_type& other)
@@ -471,13 +555,22 @@ namespace expu {
             std::forward_iterator FwdIt,
             std::sentinel_for<FwdIt> Sentinel>
         constexpr void insert(const const_iterator at, FwdIt first, const Sentinel last)
+        {
+            _insert_n(at, first, last, static_cast<size_type>(std::ranges::distance(first, last)));
+        }
+
+    private:
+        //Inserts [first, last) at at, where range_size is the distance between first and last. Reallocates atmost once.
+        template<
+            std::forward_iterator FwdIt,
+            std::sentinel_for<FwdIt> Sentinel>
+        constexpr void _insert_n(const const_iterator at, FwdIt first, const Sentinel last, const size_type range_size)
         {
             const auto naked_at = at._unwrapped();
 
             EXPU_VERIFY_DEBUG((_data().first <= naked_at) && (naked_at <= _data().last),
                 "Insertion at pointer does not lie within constructed range (or one after the end) of the array!");
 
-            const auto range_size      = static_cast<size_type>(std::ranges::distance(first, last));
             const auto unused_capacity = static_cast<size_type>(_data().end - _data().last);
 
             //Avoid invalidating iterators
@@ -499,6 +592,14 @@ namespace expu {
                     throw;
                 }
 
+                if constexpr (is_trivially_relocatable_v<value_type>) {
+                    uninitialised_relocate(_alloc(), _data().first, naked_at, new_first);
+                    new_last = uninitialised_relocate(_alloc(), naked_at, _data().last, new_last);
+
+                    _replace_relocated(new_first, new_last, new_capacity);
+                    return;
+                }
+
                 try {
                     _reversible_uninitialised_move(_data().first, naked_at, new_first);
                     constructed_last = new_first;
@@ -517,6 +618,21 @@ namespace expu {
             //destroy then reconstruct the elements into position. Possible explanation:
             //May be faster for trivially destructible types that are also memcpyable
             // e.g. fundamentals. Test importance of this (Note: not implemented below).
+            //Shift tail into place with a single memmove, then construct range in the gap.
+            else if constexpr (is_trivially_relocatable_v<value_type>) {
+                const pointer new_last = uninitialised_relocate(_alloc(), naked_at, _data().last, naked_at + range_size);
+
+                try {
+                    uninitialised_copy(_alloc(), first, last, naked_at);
+                }
+                catch (...) {
+                    //Provide strong guarantee
+                    uninitialised_relocate(_alloc(), naked_at + range_size, new_last, naked_at);
+                    throw;
+                }
+
+                _data().last = new_last;
+            }
             else {
                 const size_type shift_count = _data().last - naked_at;
 
@@ -590,9 +706,119 @@ namespace expu {
         }
 
     private:
+        //Size of a forward range, avoiding iterating over it if possible.
+        template<std::ranges::forward_range Range>
+        [[nodiscard]] static constexpr size_type _range_size(Range& range)
+        {
+            if constexpr (std::ranges::sized_range<Range>)
+                return static_cast<size_type>(std::ranges::size(range));
+            else
+                return static_cast<size_type>(std::ranges::distance(range));
+        }
+
+    public:
+        //Inserts range at at, reallocating atmost once if the size of range can be determined up front. Contiguous
+        //ranges of trivially copyable elements are copied with memcpy.
+        template<std::ranges::input_range Range>
+        constexpr iterator insert_range(const const_iterator at, Range&& range)
+        {
+            const auto at_index = static_cast<size_type>(at._unwrapped() - _data().first);
+
+            if constexpr (std::ranges::forward_range<Range>)
+                _insert_n(at, std::ranges::begin(range), std::ranges::end(range), _range_size(range));
+            else {
+                //Range can only be iterated once, however its size may still be known
+                if constexpr (std::ranges::sized_range<Range>) {
+                    const auto range_size = static_cast<size_type>(std::ranges::size(range));
+
+                    if (static_cast<size_type>(_data().end - _data().last) < range_size)
+                        _grow_geometric(size() + range_size);
+                }
+
+                insert(cbegin() + at_index, std::ranges::begin(range), std::ranges::end(range));
+            }
+
+            return begin() + at_index;
+        }
+
+        template<std::ranges::input_range Range>
+        constexpr void append_range(Range&& range)
+        {
+            insert_range(cend(), std::forward<Range>(range));
+        }
+
+        template<std::ranges::input_range Range>
+        constexpr darray& assign_range(Range&& range)
+        {
+            if constexpr (std::ranges::forward_range<Range>)
+                return _alt_alloc_assign(_alloc(), std::ranges::begin(range), std::ranges::end(range), _range_size(range));
+            else {
+                if constexpr (std::ranges::sized_range<Range>) {
+                    const auto range_size = static_cast<size_type>(std::ranges::size(range));
+
+                    //Current elements are about to be overwritten, hence destroy them rather than move them on growth
+                    if (capacity() < range_size) {
+                        destroy_range(_alloc(), _data().first, _data().last);
+                        _data().last = _data().first;
+
+                        _unchecked_grow_exactly(range_size);
+                    }
+                }
+
+                return assign(std::ranges::begin(range), std::ranges::end(range));
+            }
+        }
+
+    private:
+        [[nodiscard]] constexpr bool _owns_address(const void* const address) const noexcept
+        {
+            const std::less<const void*> less;
+
+            return !less(address, std::to_address(_data().first)) && less(address, std::to_address(_data().end));
+        }
+
+        //Attempts to grow the internal array without copying its elements, utilising the allocator's try_expand
+        //and reallocate extensions (if provided). Returns false if the array must be grown by other means.
+        //Note: If may_move is false, pointers to elements are guaranteed to remain valid.
+        [[nodiscard]] constexpr bool _try_grow_without_copy(const size_type new_capacity, const bool may_move)
+        {
+            if (!_data().first)
+                return false;
+
+            if constexpr (_alloc_can_try_expand<Alloc>) {
+                if (_alloc().try_expand(_data().first, capacity(), new_capacity)) {
+                    _data().end = _data().first + new_capacity;
+                    return true;
+                }
+            }
+
+            if constexpr (_alloc_can_reallocate<Alloc> && is_trivially_relocatable_v<value_type>) {
+                if (may_move) {
+                    const size_type old_size = size();
+
+                    _data().first = _alloc().reallocate(_data().first, capacity(), new_capacity);
+                    _data().last  = _data().first + old_size;
+                    _data().end   = _data().first + new_capacity;
+                    return true;
+                }
+            }
+
+            (void)may_move;
+            return false;
+        }
+
         constexpr void _unchecked_grow_exactly(const size_type new_capacity)
         {
-            if constexpr (std::is_nothrow_move_constructible_v<value_type>) {
+            if (_try_grow_without_copy(new_capacity, true))
+                return;
+
+            if constexpr (is_trivially_relocatable_v<value_type>) {
+                const pointer new_first = _alloc_traits::allocate(_alloc(), new_capacity);
+                const pointer new_last  = uninitialised_relocate(_alloc(), _data().first, _data().last, std::to_address(new_first));
+
+                _replace_relocated(new_first, new_last, new_capacity);
+            }
+            else if constexpr (std::is_nothrow_move_constructible_v<value_type>) {
                 const pointer new_first = _alloc_traits::allocate(_alloc(), new_capacity);
                 //Note: Below will not throw, hence strong guarantee provided by _resize_assign is redundant
                 const pointer new_last  = uninitialised_move(_alloc(), _data().first, _data().last, std::to_address(new_first));
@@ -600,19 +826,14 @@ namespace expu {
                 _replace(new_first, new_last, new_capacity);
             }
             else
-                _resize_assign(_alloc(), _data().first, _data().end, new_capacity);
+                _resize_assign(_alloc(), _data().first, _data().last, new_capacity);
         }
 
         constexpr size_type _calculate_growth(const size_type min_capacity) {
             if (max_size() < min_capacity)
                 throw std::bad_array_new_length();
 
-            const size_type half_size = size() >> 1;
-
-            if (max_size() - half_size < size())
-                return max_size();
-            else
-                return std::max(min_capacity, size() + half_size);
+            return static_cast<size_type>(GrowthPolicy::next_capacity(size(), min_capacity, max_size(), sizeof(value_type)));
         }
 
         constexpr void _grow_geometric(const size_type min_capacity)
@@ -635,16 +856,89 @@ namespace expu {
                 const pointer new_first = _alloc_traits::allocate(_alloc(), size());
                       pointer new_last  = nullptr;
 
-                try {
-                    new_last = _reversible_uninitialised_move(_data().first, _data().last, new_first);
+                if constexpr (is_trivially_relocatable_v<value_type>) {
+                    new_last = uninitialised_relocate(_alloc(), _data().first, _data().last, new_first);
+
+                    _replace_relocated(new_first, new_last, size());
                 }
-                catch (...) {
-                    _alloc_traits::deallocate(new_first, size());
-                    throw;
+                else {
+                    try {
+                        new_last = _reversible_uninitialised_move(_data().first, _data().last, new_first);
+                    }
+                    catch (...) {
+                        _alloc_traits::deallocate(_alloc(), new_first, size());
+                        throw;
+                    }
+
+                    _replace(new_first, new_last, size());
                 }
+            }
+        }
+
+    private:
+        //Resizes array to new_size, constructing new elements through construct(alloc, first, count), which must
+        //return one past the last element constructed.
+        template<class Construct>
+        constexpr void _resize_with(const size_type new_size, Construct construct)
+        {
+            const size_type old_size = size();
+
+            if (new_size <= old_size) {
+                const pointer new_last = _data().first + new_size;
+                destroy_range(_alloc(), new_last, _data().last);
+
+                _data().last = new_last;
+                return;
+            }
 
-                _replace(new_first, new_last, size());
+            if (capacity() < new_size)
+                _grow_geometric(new_size);
+
+            _data().last = construct(_alloc(), std::to_address(_data().last), new_size - old_size);
+        }
+
+    public:
+        //Resizes array, value-initialising any new elements.
+        constexpr void resize(const size_type new_size)
+        {
+            _resize_with(new_size, [](Alloc& alloc, value_type* const first, const size_type count) {
+                return uninitialised_value_construct_n(alloc, first, count);
+            });
+        }
+
+        constexpr void resize(const size_type new_size, const value_type& value)
+        {
+            //Value may refer to an element of this array, which growth would invalidate
+            if (capacity() < new_size && _owns_address(std::addressof(value))) {
+                const value_type copy(value);
+                resize(new_size, copy);
+                return;
             }
+
+            _resize_with(new_size, [&value](Alloc& alloc, value_type* const first, const size_type count) {
+                return uninitialised_fill_n(alloc, first, count, value);
+            });
+        }
+
+        //Resizes array, default-initialising any new elements. New trivial elements are not written to, hence
+        //they must be overwritten before being read.
+        constexpr void resize_for_overwrite(const size_type new_size)
+        {
+            _resize_with(new_size, [](Alloc& alloc, value_type* const first, const size_type count) {
+                return uninitialised_default_construct_n(alloc, first, count);
+            });
+        }
+
+        //Appends count default-initialised elements, returning them for the caller to fill.
+        [[nodiscard]] constexpr std::span<value_type> append_for_overwrite(const size_type count)
+        {
+            const size_type old_size = size();
+
+            if (max_size() - old_size < count)
+                throw std::bad_array_new_length();
+
+            resize_for_overwrite(old_size + count);
+            return std::span<value_type>(std::to_address(_data().first) + old_size, count);
         }
 
     //Indexing functions
@@ -2,6 +2,8 @@
 #define EXPU_FIXED_ARRAY_HPP_INCLUDED
 
 #include <memory>
+#include <ranges>
+#include <span>
 #include <stdexcept>
 #include <iterator>
 #include <type_traits>
@@ -9,6 +11,7 @@
 #include "expu/containers/contiguous_container.hpp"
 
 #include "expu/maths/basic_maths.hpp"
+#include "expu/maths/bit_utils.hpp"
 
 #include "expu/debug.hpp"
 #include "expu/mem_utils.hpp"
@@ -65,6 +68,13 @@ namespace expu
         SizeType size;
     };
 
+    //Packed bools are stored in words, hence allocated through Alloc rebound to expu::_bit_word.
+    template<class Alloc, bool StoresBool>
+    struct _fixed_array_storage_alloc { using type = Alloc; };
+
+    template<class Alloc>
+    struct _fixed_array_storage_alloc<Alloc, true> { using type = typename std::allocator_traits<Alloc>::template rebind_alloc<_bit_word>; };
+
     template<class Type, class Alloc = std::allocator<Type>>
     class fixed_array
     {
@@ -85,8 +95,12 @@ namespace expu
     private:
         static constexpr bool _stores_bool = std::is_same_v<std::decay_t<Type>, bool>;
 
+        using _storage_alloc_type   = typename _fixed_array_storage_alloc<Alloc, _stores_bool>::type;
+        using _storage_alloc_traits = std::allocator_traits<_storage_alloc_type>;
+        using _storage_pointer      = typename _storage_alloc_traits::pointer;
+
         using _data_type = std::conditional_t<_stores_bool,
-            _fixed_array_bool_data<size_type, pointer, const_pointer>,
+            _fixed_array_bool_data<size_type, _storage_pointer, typename _storage_alloc_traits::const_pointer>,
             _fixed_array_data<pointer, const_pointer>>;
 
     public:
@@ -106,11 +120,14 @@ namespace expu
         constexpr fixed_array(const fixed_array& other, const Alloc& alloc):
             fixed_array(alloc)
         {
-            _unallocated_assign(other._first(), other._last(), other.size());
+            if constexpr (_stores_bool)
+                _unallocated_assign_bits(other);
+            else
+                _unallocated_assign(other._first(), other._last());
         }
 
         constexpr fixed_array(const fixed_array& other) :
-            fixed_array(other, _alloc_traits::select_on_container_copy_construction(other._alloc())) {}
+            fixed_array(other, _storage_alloc_traits::select_on_container_copy_construction(other._alloc())) {}
 
         constexpr fixed_array(fixed_array&& other, const Alloc& alloc):
             fixed_array(alloc)
@@ -119,10 +136,12 @@ namespace expu
                 //On allocators compare false: Individually move, other's data
                 //cannot be deallocated using new alloc
                 if (_alloc() != other._alloc()) {
-                    _unallocated_assign(
-                        std::make_move_iterator(other._first()),
-                        std::make_move_iterator(other._last()),
-                        other.size());
+                    if constexpr (_stores_bool)
+                        _unallocated_assign_bits(other);
+                    else
+                        _unallocated_assign(
+                            std::make_move_iterator(other._first()),
+                            std::make_move_iterator(other._last()));
 
                     return;
                 }
@@ -138,28 +157,26 @@ namespace expu
         constexpr fixed_array(const size_type n, const Type& elem, const Alloc& alloc = Alloc()):
             fixed_array(alloc)
         {
-            size_type alloc_size = _stores_bool ? right_shift_round_up(n, 3) : n;
+            if constexpr (_stores_bool) {
+                const _storage_pointer new_first = _allocate_bits(n);
 
-            pointer new_first = _alloc_traits::allocate(_alloc(), alloc_size);
-            try {
-                if constexpr (_stores_bool) {
-                    //Cast to char* here to ensure that underlying data of bool is correctly set. Todo: Create fill_n function that supports checked_allocator
-                    auto as_uint8 = reinterpret_cast<uint8_t*>(std::to_address(new_first));
-                    auto new_last = std::fill_n(as_uint8, alloc_size, static_cast<uint8_t>(elem ? 0xFF : 0));
+                _fill_bits(std::to_address(new_first), n, elem);
+                _mark_bits_initialised(new_first, n, true);
 
-                    //Hack: Temporarily added support for checked allocator.
-                    _mark_initialised_if_checked_allocator(_alloc(), new_first, new_last, true);
-                    _data().size = n;
-                }
-                else
-                    _last() = uninitialised_fill_n(_alloc(), new_first, alloc_size, elem);
-            }
-            catch (...) {
-                _alloc_traits::deallocate(_alloc(), new_first, alloc_size);
-                throw;
+                _unchecked_replace(new_first, nullptr, n);
             }
+            else {
+                pointer new_first = _alloc_traits::allocate(_alloc(), n);
+                try {
+                    _last() = uninitialised_fill_n(_alloc(), new_first, n, elem);
+                }
+                catch (...) {
+                    _alloc_traits::deallocate(_alloc(), new_first, n);
+                    throw;
+                }
 
-            _first() = new_first;
+                _first() = new_first;
+            }
         }
 
         template<std::forward_iterator FwdIt, std::sentinel_for<FwdIt> Sentinel>
@@ -175,19 +192,30 @@ namespace expu
                 _unallocated_assign(first, last);
         }
 
+        //Element i is set to pred(values[i]), e.g. fixed_array<bool>(prices, [](double p) { return p > 100.0; }).
+        template<std::ranges::contiguous_range Range, class Pred>
+        requires(_stores_bool && std::predicate<Pred&, const std::ranges::range_value_t<Range>&>)
+        constexpr fixed_array(Range&& values, Pred pred, const Alloc& alloc = Alloc()):
+            fixed_array(alloc)
+        {
+            const auto range_size = static_cast<size_type>(std::ranges::size(values));
+
+            _unchecked_replace(_ctg_duplicate_predicate(std::ranges::data(values), range_size, pred), nullptr, range_size);
+        }
+
         constexpr ~fixed_array() noexcept
         {
             _clear_dealloc();
         }
 
     private: //Fixed array destruction helper functions
-        constexpr void _unchecked_replace(pointer new_first, pointer new_last, size_type new_size) noexcept
+        constexpr void _unchecked_replace(_storage_pointer new_first, pointer new_last, size_type new_size) noexcept
         {
             _first() = new_first;
             _set_sentinel(new_last, new_size);
         }
 
-        constexpr void _replace(pointer new_first, pointer new_last, size_type new_size)
+        constexpr void _replace(_storage_pointer new_first, pointer new_last, size_type new_size)
         {
             _clear_dealloc();
             _unchecked_replace(new_first, new_last, new_size);
@@ -196,48 +224,115 @@ namespace expu
         constexpr void _clear_dealloc()
         {
             if (_first()) {
-                destroy_range(_alloc(), _first(), _last());
-                _alloc_traits::deallocate(_alloc(), _first(), _size());
+                if constexpr (_stores_bool) {
+                    _mark_bits_initialised(_first(), size(), false);
+                    _deallocate_bits(_first(), size());
+                }
+                else {
+                    destroy_range(_alloc(), _first(), _last());
+                    _alloc_traits::deallocate(_alloc(), _first(), _size());
+                }
 
                 _unchecked_replace(nullptr, nullptr, 0);
             }
         }
 
-    private: //Helper assign functions
+    private: //Packed bool helper functions
+        //Note: Empty ranges are not allocated
+        [[nodiscard]] constexpr _storage_pointer _allocate_bits(const size_type bit_count)
+        {
+            if (!bit_count)
+                return nullptr;
+
+            return _storage_alloc_traits::allocate(_alloc(), _bit_word_count(bit_count));
+        }
+
+        constexpr void _deallocate_bits(const _storage_pointer first, const size_type bit_count) noexcept
+        {
+            if (first)
+                _storage_alloc_traits::deallocate(_alloc(), first, _bit_word_count(bit_count));
+        }
+
+        constexpr void _mark_bits_initialised(const _storage_pointer first, const size_type bit_count, const bool value)
+        {
+            if (first)
+                _mark_initialised_if_checked_allocator(_alloc(), std::to_address(first), std::to_address(first) + _bit_word_count(bit_count), value);
+        }
+
         template<
             std::forward_iterator InputIt,
             std::sentinel_for<InputIt> Sentinel>
-        constexpr pointer _ctg_duplicate_bits(const InputIt first, const Sentinel last, const size_type range_size)
+        constexpr _storage_pointer _ctg_duplicate_bits(const InputIt first, const Sentinel last, const size_type range_size)
         {
-            const size_type alloc_size = right_shift_round_up(range_size, 3);
+            const _storage_pointer new_first = _allocate_bits(range_size);
+            try {
+                set_bits(std::to_address(new_first), first, last);
+            }
+            catch (...) {
+                _deallocate_bits(new_first, range_size);
+                throw;
+            }
+
+            _mark_bits_initialised(new_first, range_size, true);
+            return new_first;
+        }
 
-            const pointer new_first = _alloc_traits::allocate(_alloc(), alloc_size);
+        template<class ValueType, class Pred>
+        constexpr _storage_pointer _ctg_duplicate_predicate(const ValueType* const values, const size_type range_size, Pred& pred)
+        {
+            const _storage_pointer new_first = _allocate_bits(range_size);
             try {
-                set_bits(_alloc(), std::to_address(new_first), first, last);
+                _pack_predicate(std::to_address(new_first), values, range_size, pred);
             }
             catch (...) {
-                _alloc_traits::deallocate(_alloc(), new_first, alloc_size);
+                _deallocate_bits(new_first, range_size);
                 throw;
             }
 
+            _mark_bits_initialised(new_first, range_size, true);
             return new_first;
         }
 
+        constexpr void _unallocated_assign_bits(const fixed_array& other)
+        {
+            const _storage_pointer new_first = _allocate_bits(other.size());
+
+            if (new_first)
+                std::copy_n(std::to_address(other._first()), _bit_word_count(other.size()), std::to_address(new_first));
+
+            _mark_bits_initialised(new_first, other.size(), true);
+            _unchecked_replace(new_first, nullptr, other.size());
+        }
+
+        constexpr void _assign_bits(const fixed_array& other)
+        {
+            if (size() != other.size()) {
+                _clear_dealloc();
+                _unallocated_assign_bits(other);
+            }
+            else if (_first())
+                std::copy_n(std::to_address(other._first()), _bit_word_count(size()), std::to_address(_first()));
+        }
+
+    private: //Helper assign functions
         template<
             std::forward_iterator FwdIt,
             std::sentinel_for<FwdIt> Sentinel>
-        constexpr void _unallocated_assign(const FwdIt begin, const Sentinel end, const size_type bool_size = 0)
+        constexpr void _unallocated_assign(const FwdIt begin, const Sentinel end)
         {
             const auto range_size = static_cast<size_type>(std::ranges::distance(begin, end));
 
             pointer new_last = _ctg_duplicate(_alloc(), begin, end, _first(), range_size);
-            _set_sentinel(new_last, bool_size);
+            _set_sentinel(new_last, 0);
         }
 
+        //Note: Also accepts sized input ranges, as move assignment between unequal allocators passes its elements
+        //through std::move_iterator, which is only an input iterator (though still sized) as of C++20
         template<
-            std::forward_iterator FwdIt,
-            std::sentinel_for<FwdIt> Sentinel>
-        constexpr void _alt_alloc_assign(Alloc& alt_alloc, const FwdIt first, const Sentinel last, const size_type bool_size = 0)
+            std::input_iterator InputIt,
+            std::sentinel_for<InputIt> Sentinel>
+        requires(std::forward_iterator<InputIt> || std::sized_sentinel_for<Sentinel, InputIt>)
+        constexpr void _alt_alloc_assign(Alloc& alt_alloc, const InputIt first, const Sentinel last)
         {
             const auto range_size = static_cast<size_type>(std::ranges::distance(first, last));
 
@@ -245,7 +340,7 @@ namespace expu
                 pointer new_first = nullptr;
                 pointer new_last  = _ctg_duplicate(alt_alloc, first, last, new_first, range_size);
 
-                _replace(new_first, new_last, bool_size);
+                _replace(new_first, new_last, 0);
             }
             else
                 copy(first, last, _first());
@@ -263,7 +358,7 @@ namespace expu
 
                 if (size() != range_size)
                     _replace(_ctg_duplicate_bits(first, last, range_size), nullptr, range_size);
-                else
+                else if (_first())
                     set_bits(std::to_address(_first()), first, last);
             }
             else
@@ -272,34 +367,55 @@ namespace expu
             return *this;
         }
 
+        template<std::ranges::contiguous_range Range, class Pred>
+        requires(_stores_bool && std::predicate<Pred&, const std::ranges::range_value_t<Range>&>)
+        constexpr fixed_array& assign(Range&& values, Pred pred)
+        {
+            const auto range_size = static_cast<size_type>(std::ranges::size(values));
+
+            if (size() != range_size)
+                _replace(_ctg_duplicate_predicate(std::ranges::data(values), range_size, pred), nullptr, range_size);
+            else if (_first())
+                _pack_predicate(std::to_address(_first()), std::ranges::data(values), range_size, pred);
+
+            return *this;
+        }
+
     public:
         constexpr fixed_array& operator=(const fixed_array& other)
         {
             if constexpr (_alloc_traits::propagate_on_container_copy_assignment::value) {
                 if constexpr (!_alloc_traits::is_always_equal::value) {
-                    if (_alloc() != other._alloc()) {
-                        _alt_alloc_assign(other._alloc(), other._first(), other._last(), other.size());
-                        _alloc() = other._alloc();
-                        return *this;
-                    }
+                    //Note: Memory cannot be deallocated by other's allocator, hence it is released before propagating
+                    if (_alloc() != other._alloc())
+                        _clear_dealloc();
                 }
 
                 _alloc() = other._alloc();
             }
 
-            return _alt_alloc_assign(_alloc(), other._first(), other._last(), other.size());
+            if constexpr (_stores_bool)
+                _assign_bits(other);
+            else
+                _alt_alloc_assign(_alloc(), other._first(), other._last());
+
+            return *this;
         }
 
-        constexpr fixed_array& operator=(fixed_array&& other) noexcept
+        //Note: Allocators which neither propagate nor always compare equal may require elements to be moved one by one
+        constexpr fixed_array& operator=(fixed_array&& other)
+            noexcept(_alloc_traits::propagate_on_container_move_assignment::value || _alloc_traits::is_always_equal::value)
         {
             if constexpr (!_alloc_traits::propagate_on_container_move_assignment::value) {
                 if constexpr (!_alloc_traits::is_always_equal::value) {
                     if (_alloc() != other._alloc()) {
-                        _alt_alloc_assign(
-                            _alloc(),
-                            std::make_move_iterator(other._first()),
-                            std::make_move_iterator(other._last()),
-                            other.size());
+                        if constexpr (_stores_bool)
+                            _assign_bits(other);
+                        else
+                            _alt_alloc_assign(
+                                _alloc(),
+                                std::make_move_iterator(other._first()),
+                                std::make_move_iterator(other._last()));
 
                         return *this;
                     }
@@ -322,7 +438,7 @@ namespace expu
             EXPU_L1_ITER_VERIFY(index < size(), "heap_array index out of bounds!");
 
             if constexpr (_stores_bool)
-                return _bool_index(std::to_address(_first()) + (index >> 3), index & 7);
+                return _bool_index(std::to_address(_first()) + (index >> _bit_word_shift), index & (_bit_word_bits - 1));
             else
                 return _first()[index];
         }
@@ -335,7 +451,7 @@ namespace expu
         }
         constexpr reference at(const size_type index)
         {
-            if (index < _size())
+            if (index < size())
                 return this->operator[](index);
             else
                 throw std::out_of_range("heap_array index out of bounds!");
@@ -345,12 +461,9 @@ namespace expu
         constexpr reference       operator[](const size_type index)       noexcept { return _index_operator(index); }
 
     private:
-        constexpr size_type _size() const noexcept
+        constexpr size_type _size() const noexcept requires(!_stores_bool)
         {
-            if constexpr (_stores_bool)
-                return right_shift_round_up(_data().size, 3);
-            else
-                return static_cast<size_type>(_last() - _first());
+            return static_cast<size_type>(_last() - _first());
         }
 
     public:
@@ -362,17 +475,117 @@ namespace expu
                 return _size();
         }
 
-    private: //Helper range getter functions
-        [[nodiscard]] constexpr iterator _end() const noexcept
+    public: //Packed bool algorithms, processing a word of bits per step
+        [[nodiscard]] constexpr size_type count(const bool value = true) const noexcept requires(_stores_bool)
         {
-            if constexpr (_stores_bool) {
-                //Check to see if at boundary
-                uint8_t remainder = size() & 7;
-                if (remainder != 0)
-                    return iterator(_first() + (size() >> 3), remainder, &_data());
+            const auto set_count = static_cast<size_type>(_count_words(std::to_address(_first()), _bit_word_count(size())));
+            return value ? set_count : size() - set_count;
+        }
+
+        //Index of the first element equal to value, or size() if there is none.
+        [[nodiscard]] constexpr size_type find_first(const bool value = true) const noexcept requires(_stores_bool)
+        {
+            return static_cast<size_type>(_find_bit(std::to_address(_first()), 0, size(), value));
+        }
+
+        //Index of the first element after pos equal to value, or size() if there is none.
+        [[nodiscard]] constexpr size_type find_next(const size_type pos, const bool value = true) const noexcept requires(_stores_bool)
+        {
+            if (size() <= pos)
+                return size();
+
+            return static_cast<size_type>(_find_bit(std::to_address(_first()), pos + 1, size(), value));
+        }
+
+        [[nodiscard]] constexpr bool any()  const noexcept requires(_stores_bool) { return find_first(true) != size(); }
+        [[nodiscard]] constexpr bool all()  const noexcept requires(_stores_bool) { return find_first(false) == size(); }
+        [[nodiscard]] constexpr bool none() const noexcept requires(_stores_bool) { return !any(); }
+
+        //Writes each element to out as a 0 or 1 byte, out must hold size() elements.
+        constexpr void unpack_into(const std::span<uint8_t> out) const noexcept requires(_stores_bool)
+        {
+            EXPU_VERIFY_DEBUG(size() <= out.size(), "Output range is too small!");
+            _unpack_bytes(std::to_address(_first()), size(), out.data());
+        }
+
+        constexpr void unpack_into(const std::span<bool> out) const noexcept requires(_stores_bool)
+        {
+            EXPU_VERIFY_DEBUG(size() <= out.size(), "Output range is too small!");
+            _unpack_bytes(std::to_address(_first()), size(), reinterpret_cast<uint8_t*>(out.data()));
+        }
+
+    private:
+        template<class Op>
+        constexpr fixed_array& _transform_bits(const fixed_array& other, const Op op) noexcept
+        {
+            EXPU_VERIFY_DEBUG(size() == other.size(), "Bitwise operations require equally sized arrays!");
+
+            _transform_words(std::to_address(_first()), std::to_address(_first()), std::to_address(other._first()), _bit_word_count(size()), op);
+            return *this;
+        }
+
+    public: //Packed bool bitwise operations
+        constexpr fixed_array& operator&=(const fixed_array& other) noexcept requires(_stores_bool) { return _transform_bits(other, _bit_and{}); }
+        constexpr fixed_array& operator|=(const fixed_array& other) noexcept requires(_stores_bool) { return _transform_bits(other, _bit_or{});  }
+        constexpr fixed_array& operator^=(const fixed_array& other) noexcept requires(_stores_bool) { return _transform_bits(other, _bit_xor{}); }
+
+        //Clears every element set in other, i.e. *this &= ~other.
+        constexpr fixed_array& and_not(const fixed_array& other) noexcept requires(_stores_bool) { return _transform_bits(other, _bit_and_not{}); }
+
+        constexpr fixed_array& flip() noexcept requires(_stores_bool)
+        {
+            if (_first()) {
+                _bit_word* const words = std::to_address(_first());
+                const size_type word_count = _bit_word_count(size());
+
+                for (size_type index = 0; index != word_count; ++index)
+                    words[index] = ~words[index];
+
+                words[word_count - 1] &= _bit_tail_mask(size());
             }
 
-            return iterator(_last(), &_data());
+            return *this;
+        }
+
+        //As with std::bitset, shifting left moves element i to i + shift.
+        constexpr fixed_array& operator<<=(const size_type shift) noexcept requires(_stores_bool)
+        {
+            _shift_bits_up(std::to_address(_first()), size(), shift);
+            return *this;
+        }
+
+        constexpr fixed_array& operator>>=(const size_type shift) noexcept requires(_stores_bool)
+        {
+            _shift_bits_down(std::to_address(_first()), size(), shift);
+            return *this;
+        }
+
+        //Fused forms of count(*this op other), never materialising the intermediate array.
+        [[nodiscard]] constexpr size_type count_and(const fixed_array& other) const noexcept requires(_stores_bool) { return _count_transformed(other, _bit_and{}); }
+        [[nodiscard]] constexpr size_type count_or(const fixed_array& other)  const noexcept requires(_stores_bool) { return _count_transformed(other, _bit_or{});  }
+        [[nodiscard]] constexpr size_type count_xor(const fixed_array& other) const noexcept requires(_stores_bool) { return _count_transformed(other, _bit_xor{}); }
+
+        [[nodiscard]] constexpr size_type count_and_not(const fixed_array& other) const noexcept requires(_stores_bool)
+        {
+            return _count_transformed(other, _bit_and_not{});
+        }
+
+    private:
+        template<class Op>
+        [[nodiscard]] constexpr size_type _count_transformed(const fixed_array& other, const Op op) const noexcept
+        {
+            EXPU_VERIFY_DEBUG(size() == other.size(), "Bitwise operations require equally sized arrays!");
+
+            return static_cast<size_type>(_count_transformed_words(std::to_address(_first()), std::to_address(other._first()), _bit_word_count(size()), op));
+        }
+
+    private: //Helper range getter functions
+        [[nodiscard]] constexpr iterator _end() const noexcept
+        {
+            if constexpr (_stores_bool)
+                return iterator(_first() + (size() >> _bit_word_shift), size() & (_bit_word_bits - 1), &_data());
+            else
+                return iterator(_last(), &_data());
         }
 
     public: //Range getters
@@ -384,15 +597,19 @@ namespace expu
         [[nodiscard]] constexpr const_iterator cend() const noexcept { return _end(); }
         [[nodiscard]] constexpr const_iterator end()  const noexcept { return cend(); }
 
+    public:
+        //Note: Packed bools store Alloc rebound to their words, hence it is rebound back
+        [[nodiscard]] constexpr allocator_type get_allocator() const noexcept { return allocator_type(_alloc()); }
+
 
     private: //private member getters
-        constexpr const allocator_type& _alloc() const noexcept
+        constexpr const _storage_alloc_type& _alloc() const noexcept
         {
             return _cpair.first();
         }
         constexpr auto& _alloc() noexcept
         {
-            return const_cast<allocator_type&>(static_cast<const fixed_array*>(this)->_alloc());
+            return const_cast<_storage_alloc_type&>(static_cast<const fixed_array*>(this)->_alloc());
         }
 
         constexpr const _data_type& _data() const noexcept
@@ -405,29 +622,20 @@ namespace expu
             return const_cast<_data_type&>(static_cast<const fixed_array*>(this)->_data());
         }
 
-        constexpr const pointer& _first() const noexcept
+        constexpr const _storage_pointer& _first() const noexcept
         {
             return _cpair.second().first;
         }
         constexpr auto& _first() noexcept
         {
-            return const_cast<pointer&>(static_cast<const fixed_array*>(this)->_first());
+            return const_cast<_storage_pointer&>(static_cast<const fixed_array*>(this)->_first());
         }
 
-        constexpr pointer _last() const noexcept requires(_stores_bool)
-        {
-            return _first() + _size();
-        }
-        constexpr pointer _last() noexcept requires(_stores_bool)
-        {
-            return static_cast<const fixed_array*>(this)->_last();
-        }
-
-        constexpr const pointer& _last() const noexcept
+        constexpr const pointer& _last() const noexcept requires(!_stores_bool)
         {
             return _data().last;
         }
-        constexpr auto& _last() noexcept
+        constexpr auto& _last() noexcept requires(!_stores_bool)
         {
             return const_cast<pointer&>(static_cast<const fixed_array*>(this)->_last());
         }
@@ -442,8 +650,52 @@ namespace expu
         }
 
     private:
-        compressed_pair<allocator_type, _data_type> _cpair;
+        //Note: Packed bools store Alloc rebound to their words
+        compressed_pair<_storage_alloc_type, _data_type> _cpair;
     };
+
+    //Out-of-place packed bool bitwise operations
+    template<class Alloc>
+    [[nodiscard]] constexpr fixed_array<bool, Alloc> operator&(fixed_array<bool, Alloc> lhs, const fixed_array<bool, Alloc>& rhs)
+    {
+        return std::move(lhs &= rhs);
+    }
+
+    template<class Alloc>
+    [[nodiscard]] constexpr fixed_array<bool, Alloc> operator|(fixed_array<bool, Alloc> lhs, const fixed_array<bool, Alloc>& rhs)
+    {
+        return std::move(lhs |= rhs);
+    }
+
+    template<class Alloc>
+    [[nodiscard]] constexpr fixed_array<bool, Alloc> operator^(fixed_array<bool, Alloc> lhs, const fixed_array<bool, Alloc>& rhs)
+    {
+        return std::move(lhs ^= rhs);
+    }
+
+    template<class Alloc>
+    [[nodiscard]] constexpr fixed_array<bool, Alloc> and_not(fixed_array<bool, Alloc> lhs, const fixed_array<bool, Alloc>& rhs)
+    {
+        return std::move(lhs.and_not(rhs));
+    }
+
+    template<class Alloc>
+    [[nodiscard]] constexpr fixed_array<bool, Alloc> operator~(fixed_array<bool, Alloc> arr)
+    {
+        return std::move(arr.flip());
+    }
+
+    template<class Alloc>
+    [[nodiscard]] constexpr fixed_array<bool, Alloc> operator<<(fixed_array<bool, Alloc> arr, const typename fixed_array<bool, Alloc>::size_type shift)
+    {
+        return std::move(arr <<= shift);
+    }
+
+    template<class Alloc>
+    [[nodiscard]] constexpr fixed_array<bool, Alloc> operator>>(fixed_array<bool, Alloc> arr, const typename fixed_array<bool, Alloc>::size_type shift)
+    {
+        return std::move(arr >>= shift);
+    }
 }
 
-#endif // !EXPU_FIXED_ARRAY_HPP_INCLUDED
\ No newline at end of file
+#endif // !EXPU_FIXED_ARRAY_HPP_INCLUDED
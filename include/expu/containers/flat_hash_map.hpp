@@ -0,0 +1,962 @@
+#ifndef EXPU_FLAT_HASH_MAP_HPP_INCLUDED
+#define EXPU_FLAT_HASH_MAP_HPP_INCLUDED
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h> //For access to group comparisons
+#endif
+
+#include "expu/debug.hpp"
+#include "expu/mem_utils.hpp"
+#include "expu/maths/hash_utils.hpp"
+
+namespace expu {
+
+    //////////////////////////////////////CONTROL BYTES///////////////////////////////////////////////////////////////////////////////
+
+
+    //Every slot of a flat_hash_map has a control byte, which is either empty, deleted (a tombstone, which probing
+    //continues past) or full, in which case it holds the low 7 bits of the element's hash (h2).
+    using _ctrl_t = int8_t;
+
+    inline constexpr _ctrl_t _ctrl_empty   = -128;
+    inline constexpr _ctrl_t _ctrl_deleted = -2;
+
+    [[nodiscard]] constexpr bool _is_full(const _ctrl_t ctrl) noexcept { return 0 <= ctrl; }
+
+    //Number of control bytes compared at once, hence the minimum capacity of a table
+    inline constexpr size_t _ctrl_group_width = 16;
+
+    //One bit per control byte of a group, the lowest being the first
+    using _ctrl_mask = uint32_t;
+
+    class _ctrl_group
+    {
+    public:
+        explicit _ctrl_group(const _ctrl_t* const ctrl) noexcept
+        {
+#if defined(__SSE2__)
+            _ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+            std::memcpy(_ctrl, ctrl, _ctrl_group_width);
+#endif
+        }
+
+    public:
+        [[nodiscard]] _ctrl_mask match(const _ctrl_t h2) const noexcept
+        {
+#if defined(__SSE2__)
+            return static_cast<_ctrl_mask>(_mm_movemask_epi8(_mm_cmpeq_epi8(_ctrl, _mm_set1_epi8(h2))));
+#else
+            return _match_if([=](const _ctrl_t ctrl) { return ctrl == h2; });
+#endif
+        }
+
+        [[nodiscard]] _ctrl_mask match_empty() const noexcept
+        {
+            return match(_ctrl_empty);
+        }
+
+        //Empty and deleted control bytes, being those with their sign bit set
+        [[nodiscard]] _ctrl_mask match_non_full() const noexcept
+        {
+#if defined(__SSE2__)
+            return static_cast<_ctrl_mask>(_mm_movemask_epi8(_ctrl));
+#else
+            return _match_if([](const _ctrl_t ctrl) { return !_is_full(ctrl); });
+#endif
+        }
+
+    private:
+#if defined(__SSE2__)
+        __m128i _ctrl;
+#else
+        template<class Pred>
+        [[nodiscard]] _ctrl_mask _match_if(const Pred pred) const noexcept
+        {
+            _ctrl_mask result = 0;
+            for (size_t index = 0; index != _ctrl_group_width; ++index)
+                result |= _ctrl_mask(pred(_ctrl[index])) << index;
+
+            return result;
+        }
+
+        _ctrl_t _ctrl[_ctrl_group_width];
+#endif
+    };
+
+    //Note: Hashes are mixed (see expu::_mix_hash) before being split into h1 (where probing starts) and h2 (stored
+    //in the control byte).
+    [[nodiscard]] constexpr size_t _hash_h1(const size_t hash) noexcept { return hash >> 7; }
+    [[nodiscard]] constexpr _ctrl_t _hash_h2(const size_t hash) noexcept { return static_cast<_ctrl_t>(hash & 0x7F); }
+
+    //Visits groups starting at triangular offsets (in group widths) from h1, which for power of two capacities
+    //covers every slot of the table.
+    class _probe_seq
+    {
+    public:
+        constexpr _probe_seq(const size_t h1, const size_t mask) noexcept:
+            _mask(mask), _offset(h1 & mask) {}
+
+    public:
+        [[nodiscard]] constexpr size_t offset() const noexcept { return _offset; }
+        [[nodiscard]] constexpr size_t offset(const size_t index) const noexcept { return (_offset + index) & _mask; }
+        [[nodiscard]] constexpr size_t probed() const noexcept { return _index; }
+
+        constexpr void next() noexcept
+        {
+            _index += _ctrl_group_width;
+            _offset = (_offset + _index) & _mask;
+        }
+
+    private:
+        size_t _mask;
+        size_t _offset;
+        size_t _index = 0;
+    };
+
+
+    //////////////////////////////////////FLAT HASH MAP ITERATOR///////////////////////////////////////////////////////////////////////////////
+
+
+    //Slot of a flat_hash_map. Elements are constructed and accessed as value, though moved from as mutable_value
+    //when the table grows, so that their keys are moved rather than copied.
+    //Note: Both members are pairs of the same types up to the key's const, hence share their layout.
+    template<class Key, class Mapped>
+    union _flat_hash_slot
+    {
+        constexpr _flat_hash_slot() noexcept {}
+        constexpr ~_flat_hash_slot() noexcept {}
+
+        std::pair<const Key, Mapped> value;
+        std::pair<Key, Mapped>       mutable_value;
+    };
+
+    //Note: Slot is const for const iterators
+    template<class Slot>
+    class _flat_hash_iterator
+    {
+    private:
+        using _element = decltype(Slot::value);
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = _element;
+        using difference_type   = ptrdiff_t;
+        using pointer           = std::conditional_t<std::is_const_v<Slot>, const _element*, _element*>;
+        using reference         = std::conditional_t<std::is_const_v<Slot>, const _element&, _element&>;
+
+    public:
+        constexpr _flat_hash_iterator() noexcept = default;
+
+        //Note: Skips forward to the first full slot, if ctrl is not full
+        constexpr _flat_hash_iterator(const _ctrl_t* const ctrl, const _ctrl_t* const ctrl_end, Slot* const slot) noexcept:
+            _ctrl(ctrl), _ctrl_end(ctrl_end), _slot(slot)
+        {
+            _skip_non_full();
+        }
+
+        template<class OtherSlot>
+        requires(std::is_same_v<const OtherSlot, Slot> && !std::is_same_v<OtherSlot, Slot>)
+        constexpr _flat_hash_iterator(const _flat_hash_iterator<OtherSlot>& other) noexcept:
+            _ctrl(other._ctrl), _ctrl_end(other._ctrl_end), _slot(other._slot) {}
+
+    public:
+        [[nodiscard]] constexpr reference operator*()  const noexcept { return _slot->value; }
+        [[nodiscard]] constexpr pointer   operator->() const noexcept { return std::addressof(_slot->value); }
+
+    public:
+        constexpr _flat_hash_iterator& operator++() noexcept
+        {
+            EXPU_VERIFY_DEBUG(_ctrl != _ctrl_end, "Cannot increment end iterator!");
+
+            ++_ctrl;
+            ++_slot;
+            _skip_non_full();
+
+            return *this;
+        }
+
+        [[nodiscard("Prefer pre-increment operator.")]]
+        constexpr _flat_hash_iterator operator++(int) noexcept
+        {
+            const _flat_hash_iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(const _flat_hash_iterator& lhs, const _flat_hash_iterator& rhs) noexcept
+        {
+            return lhs._ctrl == rhs._ctrl;
+        }
+
+    private:
+        constexpr void _skip_non_full() noexcept
+        {
+            for (; _ctrl != _ctrl_end && !_is_full(*_ctrl); ++_ctrl)
+                ++_slot;
+        }
+
+    private:
+        template<class>
+        friend class _flat_hash_iterator;
+
+        template<class, class, class, class, class>
+        friend class flat_hash_map;
+
+        const _ctrl_t* _ctrl     = nullptr;
+        const _ctrl_t* _ctrl_end = nullptr;
+        Slot*          _slot     = nullptr;
+    };
+
+
+    //////////////////////////////////////FLAT HASH MAP///////////////////////////////////////////////////////////////////////////////
+
+
+    //Open addressing hash map, storing elements inline in a power of two number of slots, alongside a control byte
+    //per slot (see expu::_ctrl_t). Lookups compare the 7 bit h2 of 16 control bytes at once (see expu::_ctrl_group),
+    //hence only touch slots whose h2 matches, which is rarely more than the one being searched for.
+    //Tables are grown once 7/8 of their slots are full or deleted.
+    //Note: Memory is allocated through Alloc and obeys its propagation traits, as with darray.
+    //Note: Hash and KeyEqual are default constructed for each use (as with linear_map's KeyEqual), hence must be stateless.
+    //Note: Insertion invalidates iterators and references if the table grows, erasion never does.
+    template<
+        class KeyType,
+        class MappedType,
+        class Hash     = std::hash<KeyType>,
+        class KeyEqual = std::equal_to<KeyType>,
+        class Alloc    = std::allocator<std::pair<const KeyType, MappedType>>>
+    class flat_hash_map
+    {
+    private:
+        using _alloc_traits = std::allocator_traits<Alloc>;
+        using _ctrl_alloc   = typename _alloc_traits::template rebind_alloc<_ctrl_t>;
+        using _ctrl_traits  = std::allocator_traits<_ctrl_alloc>;
+
+        using _slot_t      = _flat_hash_slot<KeyType, MappedType>;
+        using _slot_alloc  = typename _alloc_traits::template rebind_alloc<_slot_t>;
+        using _slot_traits = std::allocator_traits<_slot_alloc>;
+
+        using _hash_alloc  = typename _alloc_traits::template rebind_alloc<size_t>;
+        using _hash_traits = std::allocator_traits<_hash_alloc>;
+
+        static_assert(std::is_same_v<std::pair<const KeyType, MappedType>, typename _alloc_traits::value_type>);
+
+    public: //Typedefs
+        using key_type        = KeyType;
+        using mapped_type     = MappedType;
+        using value_type      = std::pair<const KeyType, MappedType>;
+        using hasher          = Hash;
+        using key_equal       = KeyEqual;
+        using allocator_type  = Alloc;
+        using reference       = value_type&;
+        using const_reference = const value_type&;
+        using size_type       = size_t;
+        using difference_type = ptrdiff_t;
+        using iterator        = _flat_hash_iterator<_slot_t>;
+        using const_iterator  = _flat_hash_iterator<const _slot_t>;
+
+    private:
+        struct _table_t {
+            typename _ctrl_traits::pointer  ctrl  = nullptr;
+            typename _slot_traits::pointer  slots = nullptr;
+
+            size_type capacity    = 0;
+            size_type size        = 0;
+            size_type growth_left = 0; //Empty slots which may be filled before the table must grow
+        };
+
+    public: //Constructors
+        constexpr flat_hash_map() noexcept(std::is_nothrow_default_constructible_v<Alloc>):
+            _cpair(zero_then_variadic{}) {}
+
+        constexpr explicit flat_hash_map(const Alloc& alloc) noexcept:
+            _cpair(one_then_variadic{}, alloc) {}
+
+        explicit flat_hash_map(const size_type capacity, const Alloc& alloc = Alloc()):
+            flat_hash_map(alloc)
+        {
+            reserve(capacity);
+        }
+
+        template<
+            std::input_iterator InputIt,
+            std::sentinel_for<InputIt> Sentinel>
+        flat_hash_map(InputIt first, const Sentinel last, const Alloc& alloc = Alloc()):
+            flat_hash_map(alloc)
+        {
+            insert(std::move(first), last);
+        }
+
+        flat_hash_map(const std::initializer_list<value_type> elements, const Alloc& alloc = Alloc()):
+            flat_hash_map(elements.begin(), elements.end(), alloc) {}
+
+        flat_hash_map(const flat_hash_map& other, const Alloc& alloc):
+            flat_hash_map(alloc)
+        {
+            _copy_table(other);
+        }
+
+        flat_hash_map(const flat_hash_map& other):
+            flat_hash_map(other, _alloc_traits::select_on_container_copy_construction(other._alloc())) {}
+
+        flat_hash_map(flat_hash_map&& other, const Alloc& alloc):
+            flat_hash_map(alloc)
+        {
+            if constexpr (!_alloc_traits::is_always_equal::value) {
+                //Note: Other's memory cannot be deallocated by alloc, hence elements are moved individually
+                if (_alloc() != other._alloc()) {
+                    _move_elements(other);
+                    return;
+                }
+            }
+
+            _table() = std::exchange(other._table(), _table_t{});
+        }
+
+        flat_hash_map(flat_hash_map&& other) noexcept:
+            _cpair(one_then_variadic{}, std::move(other._alloc()), std::exchange(other._table(), _table_t{})) {}
+
+        ~flat_hash_map() noexcept
+        {
+            _clear_dealloc();
+        }
+
+    public: //Assignment
+        flat_hash_map& operator=(const flat_hash_map& other)
+        {
+            if (this != &other) {
+                //Note: Memory is released before propagating, as other's allocator may not be able to deallocate it
+                _clear_dealloc();
+
+                if constexpr (_alloc_traits::propagate_on_container_copy_assignment::value)
+                    _alloc() = other._alloc();
+
+                _copy_table(other);
+            }
+
+            return *this;
+        }
+
+        flat_hash_map& operator=(flat_hash_map&& other)
+            noexcept(_alloc_traits::propagate_on_container_move_assignment::value || _alloc_traits::is_always_equal::value)
+        {
+            if (this == &other)
+                return *this;
+
+            if constexpr (!_alloc_traits::propagate_on_container_move_assignment::value && !_alloc_traits::is_always_equal::value) {
+                if (_alloc() != other._alloc()) {
+                    clear();
+                    _move_elements(other);
+                    return *this;
+                }
+            }
+
+            _clear_dealloc();
+
+            if constexpr (_alloc_traits::propagate_on_container_move_assignment::value)
+                _alloc() = std::move(other._alloc());
+
+            _table() = std::exchange(other._table(), _table_t{});
+            return *this;
+        }
+
+    private: //Table helpers
+        [[nodiscard]] static constexpr size_type _max_load(const size_type capacity) noexcept
+        {
+            return capacity - capacity / 8;
+        }
+
+        //Smallest valid capacity holding size elements without growing
+        [[nodiscard]] static constexpr size_type _capacity_for(const size_type size) noexcept
+        {
+            return size ? std::bit_ceil(std::max(_ctrl_group_width, size + (size + 6) / 7)) : 0;
+        }
+
+        //Whether resizing moves elements into the new table rather than copying them (see _resize)
+        static constexpr bool _moves_on_resize =
+            is_trivially_relocatable_v<value_type> ||
+            std::is_nothrow_constructible_v<value_type, std::pair<key_type, mapped_type>&&> ||
+            !std::is_copy_constructible_v<value_type>;
+
+        static constexpr bool _nothrow_hash = noexcept(hasher()(std::declval<const key_type&>()));
+
+        [[nodiscard]] static size_t _hash(const key_type& key) noexcept(noexcept(hasher()(key)))
+        {
+            return _mix_hash(hasher()(key));
+        }
+
+        [[nodiscard]] _ctrl_t* _ctrl() const noexcept { return std::to_address(_table().ctrl); }
+        [[nodiscard]] _slot_t* _slots() const noexcept { return std::to_address(_table().slots); }
+
+        [[nodiscard]] size_type _mask() const noexcept { return _table().capacity - 1; }
+
+        //Sets the control byte, as well as its clone past the end of the table.
+        //Note: Clones of the first group let groups starting near the end be loaded without wrapping.
+        static void _set_ctrl(_ctrl_t* const ctrl, const size_type mask, const size_type index, const _ctrl_t value) noexcept
+        {
+            ctrl[index] = value;
+            ctrl[((index - _ctrl_group_width) & mask) + _ctrl_group_width] = value;
+        }
+
+        //Index of the element with the given key, or the capacity if there is none
+        [[nodiscard]] size_type _find_index(const key_type& key, const size_t hash) const
+        {
+            if (empty())
+                return _table().capacity;
+
+            const _ctrl_t* const ctrl  = _ctrl();
+            const _slot_t* const slots = _slots();
+            const _ctrl_t h2 = _hash_h2(hash);
+
+            for (_probe_seq seq(_hash_h1(hash), _mask()); ; seq.next()) {
+                EXPU_VERIFY_DEBUG(seq.probed() < _table().capacity, "Table is full, probing does not terminate!");
+
+                const _ctrl_group group(ctrl + seq.offset());
+
+                for (_ctrl_mask matches = group.match(h2); matches; matches &= matches - 1) {
+                    const size_type index = seq.offset(static_cast<size_t>(std::countr_zero(matches)));
+
+                    if (key_equal()(slots[index].value.first, key))
+                        return index;
+                }
+
+                if (group.match_empty())
+                    return _table().capacity;
+            }
+        }
+
+        //First empty or deleted slot on the probe sequence of hash
+        [[nodiscard]] static size_type _find_non_full(const _ctrl_t* const ctrl, const size_type mask, const size_t hash) noexcept
+        {
+            for (_probe_seq seq(_hash_h1(hash), mask); ; seq.next()) {
+                if (const _ctrl_mask non_full = _ctrl_group(ctrl + seq.offset()).match_non_full())
+                    return seq.offset(static_cast<size_t>(std::countr_zero(non_full)));
+            }
+        }
+
+        //Whether the table must grow before an element can be constructed into the given non full slot.
+        //Note: Filling a deleted slot never grows the table, as it does not reduce the empty slots left.
+        [[nodiscard]] bool _must_grow(const size_type index) const noexcept
+        {
+            return _table().growth_left == 0 && _ctrl()[index] != _ctrl_deleted;
+        }
+
+        //Marks the slot, into which an element was just constructed, as full
+        void _commit_insert(const size_type index, const size_t hash) noexcept
+        {
+            _table().growth_left -= (_ctrl()[index] == _ctrl_empty);
+            _set_ctrl(_ctrl(), _mask(), index, _hash_h2(hash));
+            ++_table().size;
+        }
+
+        //Reclaims deleted slots in place if they take up a good part of the table, otherwise doubles its capacity
+        void _rehash_and_grow()
+        {
+            const size_type capacity = _table().capacity;
+
+            if (size() * 32 <= capacity * 25)
+                _resize(capacity);
+            else
+                _resize(capacity * 2);
+        }
+
+        [[nodiscard]] _table_t _allocate_table(const size_type capacity)
+        {
+            _ctrl_alloc ctrl_alloc(std::as_const(_alloc()));
+            _slot_alloc slot_alloc(std::as_const(_alloc()));
+
+            _table_t table;
+            table.ctrl = _ctrl_traits::allocate(ctrl_alloc, capacity + _ctrl_group_width);
+
+            try {
+                table.slots = _slot_traits::allocate(slot_alloc, capacity);
+            }
+            catch (...) {
+                _ctrl_traits::deallocate(ctrl_alloc, table.ctrl, capacity + _ctrl_group_width);
+                throw;
+            }
+
+            std::memset(std::to_address(table.ctrl), static_cast<unsigned char>(_ctrl_empty), capacity + _ctrl_group_width);
+
+            table.capacity    = capacity;
+            table.growth_left = _max_load(capacity);
+
+            return table;
+        }
+
+        void _deallocate_table(const _table_t& table) noexcept
+        {
+            if (table.capacity) {
+                _ctrl_alloc ctrl_alloc(std::as_const(_alloc()));
+                _slot_alloc slot_alloc(std::as_const(_alloc()));
+
+                _ctrl_traits::deallocate(ctrl_alloc, table.ctrl, table.capacity + _ctrl_group_width);
+                _slot_traits::deallocate(slot_alloc, table.slots, table.capacity);
+            }
+        }
+
+        void _destroy_elements() noexcept
+        {
+            if constexpr (!std::is_trivially_destructible_v<value_type>) {
+                const _ctrl_t* const ctrl = _ctrl();
+                _slot_t* const slots = _slots();
+
+                for (size_type index = 0; index != _table().capacity; ++index)
+                    if (_is_full(ctrl[index]))
+                        _alloc_traits::destroy(_alloc(), &slots[index].value);
+            }
+        }
+
+        void _clear_dealloc() noexcept
+        {
+            _destroy_elements();
+            _deallocate_table(_table());
+            _table() = _table_t{};
+        }
+
+        //Moves every element into a new table of the given capacity.
+        //Note: Provides the strong guarantee, elements which may throw on move being copied (see std::move_if_noexcept).
+        //Elements which can neither be copied nor moved without throwing are moved regardless, and a throwing move
+        //leaves the map empty.
+        void _resize(const size_type capacity)
+        {
+            //Note: Elements moved before a throwing hasher would be in neither table, hence their hashes are all
+            //computed before any is moved
+            if constexpr (_moves_on_resize && !_nothrow_hash) {
+                if (!empty()) {
+                    const size_type old_capacity = _table().capacity;
+
+                    _hash_alloc hash_alloc(std::as_const(_alloc()));
+                    const auto hashes = _hash_traits::allocate(hash_alloc, old_capacity);
+
+                    try {
+                        for (size_type index = 0; index != old_capacity; ++index)
+                            if (_is_full(_ctrl()[index]))
+                                std::to_address(hashes)[index] = _hash(_slots()[index].value.first);
+
+                        _resize(capacity, std::to_address(hashes));
+                    }
+                    catch (...) {
+                        _hash_traits::deallocate(hash_alloc, hashes, old_capacity);
+                        throw;
+                    }
+
+                    _hash_traits::deallocate(hash_alloc, hashes, old_capacity);
+                    return;
+                }
+            }
+
+            _resize(capacity, nullptr);
+        }
+
+        //Note: Hashes, if given, are those of every full slot, otherwise they are computed while moving
+        void _resize(const size_type capacity, const size_t* const hashes)
+        {
+            _table_t table = _allocate_table(capacity);
+
+            _ctrl_t* const new_ctrl = std::to_address(table.ctrl);
+            _slot_t* const new_slots = std::to_address(table.slots);
+
+            const _ctrl_t* const ctrl = _ctrl();
+            _slot_t* const slots = _slots();
+
+            size_type index = 0;
+            try {
+                for (; index != _table().capacity; ++index) {
+                    if (!_is_full(ctrl[index]))
+                        continue;
+
+                    const size_t hash = hashes ? hashes[index] : _hash(slots[index].value.first);
+                    const size_type new_index = _find_non_full(new_ctrl, capacity - 1, hash);
+
+                    if constexpr (is_trivially_relocatable_v<value_type>)
+                        uninitialised_relocate(_alloc(), &slots[index].value, &slots[index].value + 1, &new_slots[new_index].value);
+                    else if constexpr (_moves_on_resize) {
+                        _alloc_traits::construct(_alloc(), &new_slots[new_index].value, std::move(slots[index].mutable_value));
+                        _alloc_traits::destroy(_alloc(), &slots[index].value);
+                    }
+                    else
+                        _alloc_traits::construct(_alloc(), &new_slots[new_index].value, slots[index].value);
+
+                    _set_ctrl(new_ctrl, capacity - 1, new_index, ctrl[index]);
+                }
+            }
+            catch (...) {
+                for (size_type new_index = 0; new_index != capacity; ++new_index)
+                    if (_is_full(new_ctrl[new_index]))
+                        _alloc_traits::destroy(_alloc(), &new_slots[new_index].value);
+
+                //Note: Hashing cannot throw once elements are moved (see above), only moving itself, in which case
+                //elements before index were moved from and destroyed, hence the old table is only intact when copying
+                if constexpr (_moves_on_resize) {
+                    for (; index != _table().capacity; ++index)
+                        if (_is_full(ctrl[index]))
+                            _alloc_traits::destroy(_alloc(), &slots[index].value);
+
+                    _deallocate_table(_table());
+                    _table() = _table_t{};
+                }
+
+                _deallocate_table(table);
+                throw;
+            }
+
+            if constexpr (!_moves_on_resize)
+                _destroy_elements();
+
+            table.size         = size();
+            table.growth_left -= size();
+
+            _deallocate_table(_table());
+            _table() = table;
+        }
+
+        //Copies other's table slot for slot, hence without rehashing
+        void _copy_table(const flat_hash_map& other)
+        {
+            if (other.empty())
+                return;
+
+            _table_t table = _allocate_table(other._table().capacity);
+
+            _ctrl_t* const new_ctrl = std::to_address(table.ctrl);
+            _slot_t* const new_slots = std::to_address(table.slots);
+
+            const _ctrl_t* const ctrl = other._ctrl();
+            const _slot_t* const slots = other._slots();
+
+            size_type index = 0;
+            try {
+                for (; index != table.capacity; ++index)
+                    if (_is_full(ctrl[index]))
+                        _alloc_traits::construct(_alloc(), &new_slots[index].value, slots[index].value);
+            }
+            catch (...) {
+                for (size_type constructed = 0; constructed != index; ++constructed)
+                    if (_is_full(ctrl[constructed]))
+                        _alloc_traits::destroy(_alloc(), &new_slots[constructed].value);
+
+                _deallocate_table(table);
+                throw;
+            }
+
+            std::memcpy(new_ctrl, ctrl, table.capacity + _ctrl_group_width);
+
+            table.size        = other._table().size;
+            table.growth_left = other._table().growth_left;
+
+            _table() = table;
+        }
+
+        //Note: Other is cleared, as its keys are moved from
+        void _move_elements(flat_hash_map& other)
+        {
+            reserve(other.size());
+
+            const _ctrl_t* const ctrl = other._ctrl();
+            _slot_t* const slots = other._slots();
+
+            try {
+                for (size_type index = 0; index != other._table().capacity; ++index)
+                    if (_is_full(ctrl[index]))
+                        try_emplace(std::move(slots[index].mutable_value.first), std::move(slots[index].mutable_value.second));
+            }
+            catch (...) {
+                other.clear();
+                throw;
+            }
+
+            other.clear();
+        }
+
+        void _erase_at(const size_type index) noexcept
+        {
+            _ctrl_t* const ctrl = _ctrl();
+            _alloc_traits::destroy(_alloc(), &_slots()[index].value);
+
+            //Note: If no group containing the slot was ever full, no probe sequence has continued past it, hence it
+            //may be emptied rather than deleted
+            const _ctrl_mask empty_after  = _ctrl_group(ctrl + index).match_empty();
+            const _ctrl_mask empty_before = _ctrl_group(ctrl + ((index - _ctrl_group_width) & _mask())).match_empty();
+
+            const bool was_never_full = empty_before && empty_after &&
+                static_cast<size_t>(std::countr_zero(empty_after) + std::countl_zero(empty_before) - (32 - _ctrl_group_width)) < _ctrl_group_width;
+
+            _set_ctrl(ctrl, _mask(), index, was_never_full ? _ctrl_empty : _ctrl_deleted);
+            _table().growth_left += was_never_full;
+            --_table().size;
+        }
+
+        [[nodiscard]] iterator _make_iterator(const size_type index) noexcept
+        {
+            return iterator(_ctrl() + index, _ctrl() + _table().capacity, _slots() + index);
+        }
+
+        [[nodiscard]] const_iterator _make_iterator(const size_type index) const noexcept
+        {
+            return const_iterator(_ctrl() + index, _ctrl() + _table().capacity, _slots() + index);
+        }
+
+    public: //Lookup
+        [[nodiscard]] iterator find(const key_type& key)
+        {
+            return _make_iterator(_find_index(key, _hash(key)));
+        }
+
+        [[nodiscard]] const_iterator find(const key_type& key) const
+        {
+            return _make_iterator(_find_index(key, _hash(key)));
+        }
+
+        [[nodiscard]] bool contains(const key_type& key) const
+        {
+            return _find_index(key, _hash(key)) != _table().capacity;
+        }
+
+        [[nodiscard]] size_type count(const key_type& key) const
+        {
+            return contains(key);
+        }
+
+        [[nodiscard]] const mapped_type& at(const key_type& key) const
+        {
+            const size_type index = _find_index(key, _hash(key));
+
+            if (index == _table().capacity)
+                throw std::out_of_range("Key not found!");
+            else
+                return _slots()[index].value.second;
+        }
+
+        [[nodiscard]] mapped_type& at(const key_type& key)
+        {
+            return const_cast<mapped_type&>(static_cast<const flat_hash_map&>(*this).at(key));
+        }
+
+        mapped_type& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+
+        mapped_type& operator[](key_type&& key)
+        {
+            return try_emplace(std::move(key)).first->second;
+        }
+
+    public: //Insertion
+        //Constructs the mapped value from args if the key is not present, returning the element and whether it was inserted.
+        template<class Key, class ... Args>
+        requires(std::is_same_v<std::remove_cvref_t<Key>, key_type>)
+        std::pair<iterator, bool> try_emplace(Key&& key, Args&& ... args)
+        {
+            const size_t hash = _hash(key);
+
+            if (const size_type index = _find_index(key, hash); index != _table().capacity)
+                return { _make_iterator(index), false };
+
+            if (_table().capacity == 0)
+                _resize(_ctrl_group_width);
+
+            size_type index = _find_non_full(_ctrl(), _mask(), hash);
+
+            if (_must_grow(index)) {
+                //Note: Args may refer to elements of the map, hence the element is constructed before the table is resized.
+                //Its key is not const, so that it may be moved into the slot.
+                std::pair<key_type, mapped_type> element(
+                    std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<Key>(key)),
+                    std::forward_as_tuple(std::forward<Args>(args)...));
+
+                _rehash_and_grow();
+
+                index = _find_non_full(_ctrl(), _mask(), hash);
+                _alloc_traits::construct(_alloc(), &_slots()[index].value, std::move(element));
+            }
+            else
+                _alloc_traits::construct(_alloc(), &_slots()[index].value,
+                    std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<Key>(key)),
+                    std::forward_as_tuple(std::forward<Args>(args)...));
+
+            _commit_insert(index, hash);
+            return { _make_iterator(index), true };
+        }
+
+        //Note: The element is constructed before its key can be looked up, and discarded if the key is present
+        template<class ... Args>
+        std::pair<iterator, bool> emplace(Args&& ... args)
+        {
+            std::pair<key_type, mapped_type> element(std::forward<Args>(args)...);
+            return try_emplace(std::move(element.first), std::move(element.second));
+        }
+
+        std::pair<iterator, bool> insert(const value_type& element)
+        {
+            return try_emplace(element.first, element.second);
+        }
+
+        std::pair<iterator, bool> insert(value_type&& element)
+        {
+            return try_emplace(element.first, std::move(element.second));
+        }
+
+        template<
+            std::input_iterator InputIt,
+            std::sentinel_for<InputIt> Sentinel>
+        void insert(InputIt first, const Sentinel last)
+        {
+            if constexpr (std::sized_sentinel_for<Sentinel, InputIt>)
+                reserve(size() + static_cast<size_type>(last - first));
+
+            for (; first != last; ++first)
+                insert(*first);
+        }
+
+        void insert(const std::initializer_list<value_type> elements)
+        {
+            insert(elements.begin(), elements.end());
+        }
+
+        template<class Key, class Mapped>
+        requires(std::is_same_v<std::remove_cvref_t<Key>, key_type>)
+        std::pair<iterator, bool> insert_or_assign(Key&& key, Mapped&& mapped)
+        {
+            auto result = try_emplace(std::forward<Key>(key), std::forward<Mapped>(mapped));
+
+            if (!result.second)
+                result.first->second = std::forward<Mapped>(mapped);
+
+            return result;
+        }
+
+    public: //Erasion
+        //Returns the iterator following the erased element.
+        iterator erase(const const_iterator at) noexcept
+        {
+            EXPU_VERIFY_DEBUG(at != end(), "Cannot erase end iterator!");
+
+            const auto index = static_cast<size_type>(at._slot - _slots());
+            _erase_at(index);
+
+            return _make_iterator(index);
+        }
+
+        size_type erase(const key_type& key)
+        {
+            const size_type index = _find_index(key, _hash(key));
+
+            if (index == _table().capacity)
+                return 0;
+
+            _erase_at(index);
+            return 1;
+        }
+
+        //Destroys every element, keeping the capacity.
+        void clear() noexcept
+        {
+            if (_table().capacity) {
+                _destroy_elements();
+                std::memset(_ctrl(), static_cast<unsigned char>(_ctrl_empty), _table().capacity + _ctrl_group_width);
+
+                _table().size        = 0;
+                _table().growth_left = _max_load(_table().capacity);
+            }
+        }
+
+    public: //Capacity
+        //Grows the table so that size elements may be held without growing again.
+        void reserve(const size_type size)
+        {
+            if (_table().size + _table().growth_left < size)
+                _resize(_capacity_for(size));
+        }
+
+        [[nodiscard]] size_type size()     const noexcept { return _table().size; }
+        [[nodiscard]] size_type capacity() const noexcept { return _table().capacity; }
+        [[nodiscard]] bool      empty()    const noexcept { return _table().size == 0; }
+
+        [[nodiscard]] size_type max_size() const noexcept { return _alloc_traits::max_size(_alloc()); }
+
+        [[nodiscard]] float load_factor() const noexcept
+        {
+            return capacity() ? static_cast<float>(size()) / static_cast<float>(capacity()) : 0.0f;
+        }
+
+    public: //Comparison operators
+        [[nodiscard]] bool operator==(const flat_hash_map& other) const
+        {
+            if (size() != other.size())
+                return false;
+
+            for (const value_type& element : *this) {
+                const const_iterator loc = other.find(element.first);
+
+                if (loc == other.end() || !(loc->second == element.second))
+                    return false;
+            }
+
+            return true;
+        }
+
+    public:
+        void swap(flat_hash_map& other) noexcept
+        {
+            if constexpr (_alloc_traits::propagate_on_container_swap::value) {
+                using std::swap;
+                swap(_alloc(), other._alloc());
+            }
+            else
+                EXPU_VERIFY_DEBUG(_alloc() == other._alloc(), "Cannot swap maps whose allocators do not compare equal!");
+
+            std::swap(_table(), other._table());
+        }
+
+    public: //Iterator getters
+        [[nodiscard]] iterator begin() noexcept { return _make_iterator(0); }
+        [[nodiscard]] iterator end()   noexcept { return _make_iterator(_table().capacity); }
+
+        [[nodiscard]] const_iterator begin()  const noexcept { return _make_iterator(0); }
+        [[nodiscard]] const_iterator end()    const noexcept { return _make_iterator(_table().capacity); }
+        [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+        [[nodiscard]] const_iterator cend()   const noexcept { return end(); }
+
+    public:
+        [[nodiscard]] allocator_type get_allocator() const noexcept { return _alloc(); }
+        [[nodiscard]] hasher         hash_function() const { return hasher(); }
+        [[nodiscard]] key_equal      key_eq()        const { return key_equal(); }
+
+    //Private compressed pair access getters
+    private:
+        [[nodiscard]] constexpr       _table_t& _table()       noexcept { return _cpair.second(); }
+        [[nodiscard]] constexpr const _table_t& _table() const noexcept { return _cpair.second(); }
+
+        [[nodiscard]] constexpr       allocator_type& _alloc()       noexcept { return _cpair.first(); }
+        [[nodiscard]] constexpr const allocator_type& _alloc() const noexcept { return _cpair.first(); }
+
+    private:
+        compressed_pair<allocator_type, _table_t> _cpair;
+    };
+
+    template<template_of<flat_hash_map> FlatHashMap>
+    void swap(FlatHashMap& lhs, FlatHashMap& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+}
+
+#endif // !EXPU_FLAT_HASH_MAP_HPP_INCLUDED
@@ -0,0 +1,265 @@
+#ifndef EXPU_FLAT_MAP_HPP_INCLUDED
+#define EXPU_FLAT_MAP_HPP_INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE__)
+#include <xmmintrin.h> //For access to prefetches
+#endif
+
+#include "expu/containers/darray.hpp"
+#include "expu/containers/split_linear_map.hpp"
+
+namespace expu {
+
+    //First of length sorted keys at first which is not less than key, or first + length if there is none.
+    //Halves the range without branching on the comparison, hence without the mispredictions taken by
+    //std::lower_bound on every other step for random keys. As the next probe then depends on a load rather than
+    //a prediction, both of its candidates are prefetched.
+    template<class Key, class Compare>
+    [[nodiscard]] constexpr const Key* _branchless_lower_bound(const Key* first, size_t length, const Key& key, Compare& comp)
+    {
+        if (length == 0)
+            return first;
+
+        while (1 < length) {
+            const size_t half = length / 2;
+
+#if defined(__SSE__)
+            if (!std::is_constant_evaluated()) {
+                _mm_prefetch(reinterpret_cast<const char*>(first + half / 2), _MM_HINT_T0);
+                _mm_prefetch(reinterpret_cast<const char*>(first + half + half / 2), _MM_HINT_T0);
+            }
+#endif
+
+            //Note: Multiplying rather than selecting, as compilers turn the latter back into a branch
+            first  += half * static_cast<size_t>(comp(first[half - 1], key));
+            length -= half;
+        }
+
+        return first + static_cast<size_t>(comp(*first, key));
+    }
+
+
+    //Map keeping its keys sorted in one darray, with mapped values in a parallel darray (as with split_linear_map).
+    //Lookups binary search the key array alone (see expu::_branchless_lower_bound), and iteration visits elements
+    //in key order. Single insertions and erasions shift the elements after them, hence batches of insertions
+    //should go through insert_range, which merges them in a single pass.
+    template<
+        class KeyType,
+        class MappedType,
+        class Compare = std::less<KeyType>,
+        class Alloc   = std::allocator<KeyType>>
+    class flat_map : public _split_map_storage<flat_map<KeyType, MappedType, Compare, Alloc>, KeyType, MappedType, Alloc>
+    {
+    private:
+        using _storage = _split_map_storage<flat_map, KeyType, MappedType, Alloc>;
+
+        using typename _storage::_key_array;
+        using typename _storage::_mapped_array;
+
+        using _storage::_keys;
+        using _storage::_values;
+        using _storage::_key_data;
+
+    public: //Typedefs
+        using key_type        = KeyType;
+        using mapped_type     = MappedType;
+        using key_compare     = Compare;
+        using allocator_type  = Alloc;
+        using value_type      = std::pair<KeyType, MappedType>;
+        using reference       = std::pair<const KeyType&, MappedType&>;
+        using const_reference = std::pair<const KeyType&, const MappedType&>;
+        using size_type       = size_t;
+        using difference_type = ptrdiff_t;
+        using iterator        = _split_map_iterator<KeyType, MappedType>;
+        using const_iterator  = _split_map_iterator<KeyType, const MappedType>;
+
+    public: //Constructors
+        constexpr flat_map() = default;
+
+        constexpr explicit flat_map(const Alloc& alloc):
+            _storage(alloc) {}
+
+        //Note: Later duplicates of a key are ignored
+        constexpr flat_map(const std::initializer_list<value_type> elements, const Alloc& alloc = Alloc()):
+            flat_map(alloc)
+        {
+            insert_range(elements);
+        }
+
+    public:
+        //Note: Members of a dependent base are not found by unqualified lookup
+        using _storage::size;
+        using _storage::empty;
+        using _storage::begin;
+        using _storage::cbegin;
+
+    private:
+        [[nodiscard]] constexpr bool _equivalent(const key_type& lhs, const key_type& rhs) const
+        {
+            return !key_compare()(lhs, rhs) && !key_compare()(rhs, lhs);
+        }
+
+        [[nodiscard]] constexpr size_type _lower_bound_index(const key_type& key) const
+        {
+            key_compare comp;
+            return static_cast<size_type>(_branchless_lower_bound(_key_data(), size(), key, comp) - _key_data());
+        }
+
+        //Index of the element with the given key, or size() if there is none
+        [[nodiscard]] constexpr size_type _find_index(const key_type& key) const
+        {
+            const size_type index = _lower_bound_index(key);
+            return (index != size() && !key_compare()(key, _keys[index])) ? index : size();
+        }
+
+        [[nodiscard]] constexpr iterator       _make_iterator(const size_type index)       noexcept { return begin() + static_cast<difference_type>(index); }
+        [[nodiscard]] constexpr const_iterator _make_iterator(const size_type index) const noexcept { return begin() + static_cast<difference_type>(index); }
+
+    public: //Lookup
+        [[nodiscard]] constexpr iterator       lower_bound(const key_type& key)       { return _make_iterator(_lower_bound_index(key)); }
+        [[nodiscard]] constexpr const_iterator lower_bound(const key_type& key) const { return _make_iterator(_lower_bound_index(key)); }
+
+        [[nodiscard]] constexpr iterator       find(const key_type& key)       { return _make_iterator(_find_index(key)); }
+        [[nodiscard]] constexpr const_iterator find(const key_type& key) const { return _make_iterator(_find_index(key)); }
+
+        [[nodiscard]] constexpr bool contains(const key_type& key) const
+        {
+            return _find_index(key) != size();
+        }
+
+        [[nodiscard]] constexpr const mapped_type& at(const key_type& key) const
+        {
+            const size_type index = _find_index(key);
+
+            if (index == size())
+                throw std::out_of_range("Key not found!");
+            else
+                return _values[index];
+        }
+
+        [[nodiscard]] constexpr mapped_type& at(const key_type& key)
+        {
+            return const_cast<mapped_type&>(static_cast<const flat_map&>(*this).at(key));
+        }
+
+        constexpr mapped_type& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+
+    public: //Insertion
+        //Constructs the mapped value from args if the key is not present, returning the element and whether it was inserted.
+        //Note: Shifts every later element, prefer insert_range for many keys.
+        template<class ... Args>
+        constexpr std::pair<iterator, bool> try_emplace(const key_type& key, Args&& ... args)
+        {
+            const size_type index = _lower_bound_index(key);
+
+            if (index != size() && !key_compare()(key, _keys[index]))
+                return { _make_iterator(index), false };
+
+            return { this->_emplace_at(index, key, std::forward<Args>(args)...), true };
+        }
+
+        constexpr std::pair<iterator, bool> insert(const value_type& element)
+        {
+            return try_emplace(element.first, element.second);
+        }
+
+        //Inserts the elements of the range whose keys are not yet present (the first of any duplicates in the range).
+        //The range is sorted on its own, then merged with the map in a single pass, hence costs
+        //O(n + m log m) rather than the O(n m) of inserting m elements one at a time.
+        //Note: Provides the strong guarantee if key_type and mapped_type are nothrow move constructible.
+        template<std::ranges::input_range Range>
+        requires(std::is_constructible_v<value_type, std::ranges::range_reference_t<Range>>)
+        constexpr void insert_range(Range&& range)
+        {
+            darray<value_type, typename std::allocator_traits<Alloc>::template rebind_alloc<value_type>> batch(
+                std::ranges::begin(range), std::ranges::end(range), _keys.get_allocator());
+
+            //Note: Stable, so that the first of any duplicates is kept
+            std::ranges::stable_sort(batch, key_compare(), &value_type::first);
+
+            const auto duplicates = std::ranges::unique(batch, [&](const key_type& lhs, const key_type& rhs) { return _equivalent(lhs, rhs); }, &value_type::first);
+            batch.erase(duplicates.begin(), duplicates.end());
+
+            if (batch.empty())
+                return;
+
+            _key_array    keys(_keys.get_allocator());
+            _mapped_array values(_values.get_allocator());
+
+            keys.reserve(size() + batch.size());
+            values.reserve(size() + batch.size());
+
+            size_type index = 0;
+            for (value_type& element : batch) {
+                for (; index != size() && key_compare()(_keys[index], element.first); ++index) {
+                    keys.emplace_back(std::move_if_noexcept(_keys[index]));
+                    values.emplace_back(std::move_if_noexcept(_values[index]));
+                }
+
+                if (index == size() || key_compare()(element.first, _keys[index])) {
+                    keys.emplace_back(std::move(element.first));
+                    values.emplace_back(std::move(element.second));
+                }
+            }
+
+            for (; index != size(); ++index) {
+                keys.emplace_back(std::move_if_noexcept(_keys[index]));
+                values.emplace_back(std::move_if_noexcept(_values[index]));
+            }
+
+            _keys   = std::move(keys);
+            _values = std::move(values);
+        }
+
+        template<
+            std::input_iterator InputIt,
+            std::sentinel_for<InputIt> Sentinel>
+        constexpr void insert_range(InputIt first, const Sentinel last)
+        {
+            insert_range(std::ranges::subrange(std::move(first), last));
+        }
+
+    public: //Erasion
+        constexpr iterator erase(const const_iterator at)
+        {
+            const auto index = at - cbegin();
+            this->_erase_at(static_cast<size_type>(index));
+
+            return begin() + index;
+        }
+
+        constexpr size_type erase(const key_type& key)
+        {
+            const size_type index = _find_index(key);
+
+            if (index == size())
+                return 0;
+
+            erase(_make_iterator(index));
+            return 1;
+        }
+
+        constexpr void clear() noexcept
+        {
+            _keys.erase(_keys.begin(), _keys.end());
+            _values.erase(_values.begin(), _values.end());
+        }
+    };
+}
+
+#endif // !EXPU_FLAT_MAP_HPP_INCLUDED
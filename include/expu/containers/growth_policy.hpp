@@ -0,0 +1,84 @@
+#ifndef EXPU_CONTAINERS_GROWTH_POLICY_HPP_INCLUDED
+#define EXPU_CONTAINERS_GROWTH_POLICY_HPP_INCLUDED
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+
+namespace expu {
+
+    //A growth policy decides the new capacity of a container which has run out of space. next_capacity must
+    //return a value in the range [min_capacity, max_size].
+    //Note: size is the number of elements currently stored, element_size is the size (in bytes) of each element.
+    template<class Policy>
+    concept growth_policy = requires(size_t size, size_t min_capacity, size_t max_size, size_t element_size) {
+        { Policy::next_capacity(size, min_capacity, max_size, element_size) } -> std::same_as<size_t>;
+    };
+
+    //Grows by a factor of Numerator/Denominator. The default (1.5x) is that of expu::darray.
+    template<size_t Numerator = 3, size_t Denominator = 2>
+    requires(0 < Denominator && Denominator < Numerator)
+    struct geometric_growth
+    {
+        [[nodiscard]] static constexpr size_t next_capacity(size_t size, size_t min_capacity, size_t max_size, size_t)
+            noexcept
+        {
+            constexpr size_t factor = Numerator - Denominator;
+
+            //Note: Avoids computing size * factor, which may overflow
+            const size_t quotient = size / Denominator;
+            if ((max_size - size) / factor < quotient)
+                return max_size;
+
+            const size_t step = quotient * factor + (size % Denominator) * factor / Denominator;
+            if (max_size - size < step)
+                return max_size;
+
+            return std::max(min_capacity, size + step);
+        }
+    };
+
+    using doubling_growth = geometric_growth<2, 1>;
+
+    //Rounds the capacity chosen by BasePolicy up, such that the whole buffer fills a multiple of PageSize bytes.
+    //Avoids wasting the tail of the last page of very large buffers.
+    template<growth_policy BasePolicy = geometric_growth<>, size_t PageSize = 4096>
+    requires(0 < PageSize)
+    struct page_rounded_growth
+    {
+        [[nodiscard]] static constexpr size_t next_capacity(size_t size, size_t min_capacity, size_t max_size, size_t element_size)
+            noexcept
+        {
+            const size_t capacity = BasePolicy::next_capacity(size, min_capacity, max_size, element_size);
+
+            //Leave capacity as is, if rounding would overflow
+            constexpr size_t max_value = std::numeric_limits<size_t>::max();
+            if (max_value / element_size < capacity || max_value - capacity * element_size < PageSize)
+                return capacity;
+
+            const size_t bytes   = capacity * element_size;
+            const size_t rounded = bytes + (PageSize - bytes % PageSize) % PageSize;
+
+            return std::min(max_size, rounded / element_size);
+        }
+    };
+
+    //Grows as BasePolicy would, but by atmost MaxStep elements at a time. Trades more frequent re-allocations
+    //for a bound on the unused capacity of large buffers.
+    template<size_t MaxStep, growth_policy BasePolicy = geometric_growth<>>
+    requires(0 < MaxStep)
+    struct capped_growth
+    {
+        [[nodiscard]] static constexpr size_t next_capacity(size_t size, size_t min_capacity, size_t max_size, size_t element_size)
+            noexcept
+        {
+            const size_t capacity = BasePolicy::next_capacity(size, min_capacity, max_size, element_size);
+            const size_t capped   = (max_size - size < MaxStep) ? max_size : size + MaxStep;
+
+            return std::max(min_capacity, std::min(capacity, capped));
+        }
+    };
+}
+
+#endif // !EXPU_CONTAINERS_GROWTH_POLICY_HPP_INCLUDED
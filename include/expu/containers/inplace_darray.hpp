@@ -0,0 +1,489 @@
+#ifndef EXPU_CONTAINERS_INPLACE_DARRAY_HPP_INCLUDED
+#define EXPU_CONTAINERS_INPLACE_DARRAY_HPP_INCLUDED
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+#include "expu/containers/contiguous_container.hpp"
+
+#include "expu/debug.hpp"
+#include "expu/mem_utils.hpp"
+
+namespace expu {
+
+    //Elements are stored inside the data itself, hence iterators need only refer to it
+    template<class Type, size_t Capacity>
+    struct _inplace_darray_data {
+    public:
+        using pointer       = Type*;
+        using const_pointer = const Type*;
+
+    public:
+        constexpr _inplace_darray_data() noexcept:
+            last(first) {}
+
+        //Note: Elements are destroyed by expu::inplace_darray
+        constexpr ~_inplace_darray_data() noexcept {}
+
+        _inplace_darray_data(const _inplace_darray_data&)            = delete;
+        _inplace_darray_data& operator=(const _inplace_darray_data&) = delete;
+
+    public:
+        //Note: Anonymous union avoids default constructing elements.
+        union {
+            Type first[Capacity]; //Storage of container's elements.
+        };
+
+        Type* last; //Address of last element (Type) stored by container.
+    };
+
+    //Dynamic array with a fixed capacity, whose elements are stored inside the object itself. Never allocates,
+    //hence may be used in constant expressions and wherever allocations are forbidden.
+    //Note: Inserting past Capacity throws std::bad_alloc (as std::inplace_vector does), use the unchecked
+    //u_emplace_back and upush_back functions if capacity has already been ensured.
+    template<class Type, size_t Capacity>
+    class inplace_darray
+    {
+    private:
+        //Note: Used only to construct and destroy elements, through the mem_utils helpers.
+        using _alloc_t = std::allocator<Type>;
+
+        static_assert(0 < Capacity, "inplace_darray requires a non-zero capacity!");
+
+    //Essential typedefs (Container requirements)
+    public:
+        using value_type      = Type;
+        using reference       = Type&;
+        using const_reference = const Type&;
+        using pointer         = Type*;
+        using const_pointer   = const Type*;
+        using difference_type = ptrdiff_t;
+        using size_type       = size_t;
+
+    private:
+        using _data_t = _inplace_darray_data<Type, Capacity>;
+
+    //Iterator typedefs
+    public:
+        using iterator       = ctg_iterator<_data_t>;
+        using const_iterator = ctg_const_iterator<_data_t>;
+
+    //Special constructors (and destructor)
+    public:
+        constexpr inplace_darray() noexcept = default;
+
+        constexpr inplace_darray(const inplace_darray& other)
+            noexcept(std::is_nothrow_copy_constructible_v<value_type>)
+        {
+            _alloc_t alloc;
+            _data().last = uninitialised_copy(alloc, other._data().first, other._data().last, _data().first);
+        }
+
+        //Note: Moved-from array is left empty.
+        constexpr inplace_darray(inplace_darray&& other)
+            noexcept(is_trivially_relocatable_v<value_type> || std::is_nothrow_move_constructible_v<value_type>)
+        {
+            _steal(other);
+        }
+
+        template<
+            std::input_iterator InputIt,
+            std::sentinel_for<InputIt> Sentinel>
+        constexpr inplace_darray(InputIt first, const Sentinel last)
+        {
+            assign(first, last);
+        }
+
+        constexpr inplace_darray(std::initializer_list<value_type> values):
+            inplace_darray(values.begin(), values.end()) {}
+
+        constexpr ~inplace_darray() noexcept
+        {
+            clear();
+        }
+
+    private:
+        [[nodiscard]] constexpr pointer _end() noexcept
+        {
+            return _data().first + Capacity;
+        }
+
+        [[nodiscard]] constexpr size_type _remaining() const noexcept
+        {
+            return Capacity - size();
+        }
+
+        constexpr void _verify_remaining(const size_type count) const
+        {
+            if (_remaining() < count)
+                throw std::bad_alloc();
+        }
+
+        //Moves other's elements into this (empty) array, leaving other empty.
+        constexpr void _steal(inplace_darray& other)
+        {
+            _alloc_t alloc;
+
+            if constexpr (is_trivially_relocatable_v<value_type>)
+                _data().last = uninitialised_relocate(alloc, other._data().first, other._data().last, _data().first);
+            else {
+                _data().last = uninitialised_move(alloc, other._data().first, other._data().last, _data().first);
+                destroy_range(alloc, other._data().first, other._data().last);
+            }
+
+            other._data().last = other._data().first;
+        }
+
+    public:
+        template<
+            std::input_iterator InputIt,
+            std::sentinel_for<InputIt> Sentinel>
+        constexpr inplace_darray& assign(InputIt first, const Sentinel last)
+        {
+            _alloc_t alloc;
+
+            if constexpr (std::forward_iterator<InputIt>) {
+                const auto range_size = static_cast<size_type>(std::ranges::distance(first, last));
+
+                if (Capacity < range_size)
+                    throw std::bad_alloc();
+
+                //New range greater than size. Copy assign, then uninit copy remaining.
+                if (size() < range_size) {
+                    first = copy_until_sentinel(first, _data().first, _data().last);
+                    _data().last = uninitialised_copy(alloc, first, last, _data().last);
+                }
+                //New range smaller than size; assign range then destroy remaining.
+                else {
+                    const pointer new_last = copy(first, last, _data().first);
+                    destroy_range(alloc, new_last, _data().last);
+
+                    _data().last = new_last;
+                }
+            }
+            else {
+                clear();
+
+                for (; first != last; ++first)
+                    emplace_back(*first);
+            }
+
+            return *this;
+        }
+
+        constexpr inplace_darray& operator=(const inplace_darray& other)
+        {
+            if (this != &other)
+                assign(other.begin(), other.end());
+
+            return *this;
+        }
+
+        constexpr inplace_darray& operator=(inplace_darray&& other)
+            noexcept(is_trivially_relocatable_v<value_type> || std::is_nothrow_move_constructible_v<value_type>)
+        {
+            if (this != &other) {
+                clear();
+                _steal(other);
+            }
+
+            return *this;
+        }
+
+    public:
+        constexpr void clear() noexcept
+        {
+            _alloc_t alloc;
+
+            destroy_range(alloc, _data().first, _data().last);
+            _data().last = _data().first;
+        }
+
+        constexpr iterator erase(const const_iterator first, const const_iterator last)
+            noexcept(is_trivially_relocatable_v<value_type> || std::is_nothrow_move_assignable_v<value_type>)
+        {
+            const pointer naked_first = first._unwrapped();
+            const pointer naked_last  = last._unwrapped();
+
+            EXPU_VERIFY_DEBUG((_data().first <= naked_first) && (naked_first <= naked_last) && (naked_last <= _data().last),
+                "Erase range does not lie within constructed range of the array!");
+
+            if (naked_first != naked_last) {
+                _alloc_t alloc;
+
+                if constexpr (is_trivially_relocatable_v<value_type>) {
+                    destroy_range(alloc, naked_first, naked_last);
+                    _data().last = uninitialised_relocate(alloc, naked_last, _data().last, naked_first);
+                }
+                else {
+                    const pointer new_last = std::move(naked_last, _data().last, naked_first);
+                    destroy_range(alloc, new_last, _data().last);
+
+                    _data().last = new_last;
+                }
+            }
+
+            return iterator(naked_first, &_data());
+        }
+
+        constexpr iterator erase(const const_iterator at)
+            noexcept(noexcept(erase(at, at)))
+        {
+            return erase(at, std::next(at));
+        }
+
+    public:
+        //Unchecked emplace_back
+        template<class ... Args>
+        constexpr void u_emplace_back(Args&& ... args)
+            noexcept(std::is_nothrow_constructible_v<value_type, Args...>)
+        {
+            EXPU_VERIFY_DEBUG(_data().last != _end(), "Inplace darray has no remaining capacity!");
+
+            _alloc_t alloc;
+            std::allocator_traits<_alloc_t>::construct(alloc, _data().last, std::forward<Args>(args)...);
+
+            ++_data().last;
+        }
+
+        constexpr void upush_back(const value_type& other)
+            noexcept(std::is_nothrow_copy_constructible_v<value_type>)
+        {
+            u_emplace_back(other);
+        }
+
+        constexpr void upush_back(value_type&& other)
+            noexcept(std::is_nothrow_move_constructible_v<value_type>)
+        {
+            u_emplace_back(std::move(other));
+        }
+
+        template<class ... Args>
+        constexpr iterator emplace(const const_iterator at, Args&& ... args)
+        {
+            const pointer naked_at = at._unwrapped();
+
+            EXPU_VERIFY_DEBUG((_data().first <= naked_at) && (naked_at <= _data().last),
+                "Emplace at pointer does not lie within constructed range (or one after the end) of the array!");
+
+            _verify_remaining(1);
+
+            if (naked_at == _data().last) {
+                u_emplace_back(std::forward<Args>(args)...);
+                return iterator(naked_at, &_data());
+            }
+
+            _alloc_t alloc;
+            using alloc_traits = std::allocator_traits<_alloc_t>;
+
+            //Note: Constructing first ensures arguments referring to elements of this array remain valid.
+            value_type value(std::forward<Args>(args)...);
+
+            //Shift tail by one with a single memmove, then move value into the gap.
+            if constexpr (is_trivially_relocatable_v<value_type>) {
+                _data().last = uninitialised_relocate(alloc, naked_at, _data().last, naked_at + 1);
+                alloc_traits::construct(alloc, naked_at, std::move(value));
+            }
+            else {
+                alloc_traits::construct(alloc, _data().last, std::move(*(_data().last - 1)));
+                ++_data().last;
+
+                std::move_backward(naked_at, _data().last - 2, _data().last - 1);
+                *naked_at = std::move(value);
+            }
+
+            return iterator(naked_at, &_data());
+        }
+
+        template<class ... Args>
+        constexpr iterator emplace_back(Args&& ... args)
+        {
+            _verify_remaining(1);
+
+            u_emplace_back(std::forward<Args>(args)...);
+            return iterator(_data().last - 1, &_data());
+        }
+
+        constexpr void push_back(const value_type& other)
+        {
+            emplace_back(other);
+        }
+
+        constexpr void push_back(value_type&& other)
+        {
+            emplace_back(std::move(other));
+        }
+
+        constexpr void pop_back() noexcept
+        {
+            EXPU_VERIFY_DEBUG(!empty(), "Inplace darray is empty, no element to pop!");
+
+            _alloc_t alloc;
+            std::allocator_traits<_alloc_t>::destroy(alloc, --_data().last);
+        }
+
+        template<
+            std::input_iterator InputIt,
+            std::sentinel_for<InputIt> Sentinel>
+        constexpr void insert(const const_iterator at, InputIt first, const Sentinel last)
+        {
+            const pointer naked_at = at._unwrapped();
+
+            EXPU_VERIFY_DEBUG((_data().first <= naked_at) && (naked_at <= _data().last),
+                "Insertion at pointer does not lie within constructed range (or one after the end) of the array!");
+
+            const pointer prev_last = _data().last;
+            _alloc_t alloc;
+
+            if constexpr (std::forward_iterator<InputIt>) {
+                const auto range_size = static_cast<size_type>(std::ranges::distance(first, last));
+                _verify_remaining(range_size);
+
+                //Shift tail into place with a single memmove, then construct range in the gap.
+                if constexpr (is_trivially_relocatable_v<value_type>) {
+                    const pointer new_last = uninitialised_relocate(alloc, naked_at, _data().last, naked_at + range_size);
+
+                    try {
+                        uninitialised_copy(alloc, first, last, naked_at);
+                    }
+                    catch (...) {
+                        //Provide strong guarantee
+                        uninitialised_relocate(alloc, naked_at + range_size, new_last, naked_at);
+                        throw;
+                    }
+
+                    _data().last = new_last;
+                    return;
+                }
+                else
+                    _data().last = uninitialised_copy(alloc, first, last, _data().last);
+            }
+            else {
+                try {
+                    for (; first != last; ++first)
+                        emplace_back(*first);
+                }
+                catch (...) {
+                    destroy_range(alloc, prev_last, _data().last);
+                    _data().last = prev_last;
+                    throw;
+                }
+            }
+
+            //If insertion does not occur at end, rotate appended elements into position.
+            std::rotate(naked_at, prev_last, _data().last);
+        }
+
+    //Indexing functions
+    public:
+        [[nodiscard]] constexpr const_reference operator[](const size_type index) const noexcept
+        {
+            EXPU_VERIFY_DEBUG(index < size(), "Index out of range!");
+            return _data().first[index];
+        }
+
+        [[nodiscard]] constexpr reference operator[](const size_type index) noexcept
+        {
+            return const_cast<reference>(static_cast<const inplace_darray&>(*this).operator[](index));
+        }
+
+        [[nodiscard]] constexpr const_reference unchecked_front() const noexcept
+        {
+            EXPU_VERIFY_DEBUG(!empty(), "expu::inplace_darray is empty, no viable first value available.");
+            return *_data().first;
+        }
+
+        [[nodiscard]] constexpr reference unchecked_front() noexcept
+        {
+            return const_cast<reference>(static_cast<const inplace_darray&>(*this).unchecked_front());
+        }
+
+        [[nodiscard]] constexpr const_reference unchecked_back() const noexcept
+        {
+            EXPU_VERIFY_DEBUG(!empty(), "expu::inplace_darray is empty, no viable last value available.");
+            return *std::prev(_data().last);
+        }
+
+        [[nodiscard]] constexpr reference unchecked_back() noexcept
+        {
+            return const_cast<reference>(static_cast<const inplace_darray&>(*this).unchecked_back());
+        }
+
+        [[nodiscard]] constexpr const_reference front() const
+        {
+            if (!empty())
+                return unchecked_front();
+            else
+                throw std::out_of_range("expu::inplace_darray is empty, no viable first value available.");
+        }
+
+        [[nodiscard]] constexpr reference front()
+        {
+            return const_cast<reference>(static_cast<const inplace_darray&>(*this).front());
+        }
+
+        [[nodiscard]] constexpr const_reference back() const
+        {
+            if (!empty())
+                return unchecked_back();
+            else
+                throw std::out_of_range("expu::inplace_darray is empty, no viable last value available.");
+        }
+
+        [[nodiscard]] constexpr reference back()
+        {
+            return const_cast<reference>(static_cast<const inplace_darray&>(*this).back());
+        }
+
+    //Size getters
+    public:
+        [[nodiscard]] constexpr size_type size() const noexcept
+        {
+            return static_cast<size_type>(_data().last - _data().first);
+        }
+
+        [[nodiscard]] static constexpr size_type capacity() noexcept
+        {
+            return Capacity;
+        }
+
+        [[nodiscard]] static constexpr size_type max_size() noexcept
+        {
+            return Capacity;
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return _data().last == _data().first;
+        }
+
+        [[nodiscard]] constexpr bool full() const noexcept
+        {
+            return size() == Capacity;
+        }
+
+    //Range getters
+    public:
+        [[nodiscard]] constexpr iterator begin()              noexcept { return iterator(_data().first, &_data()); }
+        [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return const_iterator(const_cast<pointer>(_data().first), &_data()); }
+        [[nodiscard]] constexpr const_iterator begin()  const noexcept { return cbegin(); }
+
+        [[nodiscard]] constexpr iterator end()              noexcept { return iterator(_data().last, &_data()); }
+        [[nodiscard]] constexpr const_iterator cend() const noexcept { return const_iterator(_data().last, &_data()); }
+        [[nodiscard]] constexpr const_iterator end()  const noexcept { return cend(); }
+
+    private:
+        [[nodiscard]] constexpr       _data_t& _data()       noexcept { return _storage; }
+        [[nodiscard]] constexpr const _data_t& _data() const noexcept { return _storage; }
+
+    private:
+        _data_t _storage;
+    };
+
+}
+
+#endif // !EXPU_CONTAINERS_INPLACE_DARRAY_HPP_INCLUDED
@@ -1,13 +1,170 @@
 #ifndef EXPU_STATIC_MAP_HPP_INCLUDED
 #define EXPU_STATIC_MAP_HPP_INCLUDED
 
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
 #include <utility> 
 #include <vector>
 
+#if defined(__AVX2__)
+#include <immintrin.h> //For access to vector comparisons
+#endif
+
 #include "expu/containers/darray.hpp"
 
 namespace expu {
 
+    //////////////////////////////////////KEY SCAN///////////////////////////////////////////////////////////////////////////////
+
+
+    //Keys whose equality is equality of their bytes, hence can be compared a vector at a time.
+    //Note: Floating point keys are excluded, as 0.0 == -0.0 and NaN != NaN.
+    template<class Key>
+    concept _scannable_key = 
+        (std::integral<Key> || std::is_pointer_v<Key>) &&
+        (sizeof(Key) == 1 || sizeof(Key) == 2 || sizeof(Key) == 4 || sizeof(Key) == 8);
+
+    template<class Element, class Key>
+    [[nodiscard]] constexpr const Key& _key_of(const Element& element) noexcept
+    {
+        if constexpr (std::is_same_v<Element, Key>)
+            return element;
+        else
+            return element.first;
+    }
+
+    //Index of the first of count elements whose key equals key, or count if there is none. Elements are either keys
+    //themselves or standard layout pairs whose first member is the key, in which case keys lie sizeof(Element) bytes
+    //apart. Keys are compared a vector at a time (e.g. 16 int keys per AVX-512 comparison), matches in lanes holding
+    //other bytes of the elements being masked out.
+    template<_scannable_key Key, class Element>
+    [[nodiscard]] size_t _find_key(const Element* const elements, const size_t count, const Key key) noexcept
+    {
+        static_assert(std::is_same_v<Element, Key> || std::is_standard_layout_v<Element>, "Key must lie at the start of each element");
+
+        size_t index = 0;
+
+#if defined(__AVX2__)
+        //Note: Lanes holding keys repeat every element, hence whole elements must fit into each vector
+        constexpr bool vectorisable = sizeof(Element) % sizeof(Key) == 0 && 32 % sizeof(Element) == 0;
+
+        if constexpr (vectorisable) {
+            using key_bits = std::conditional_t<sizeof(Key) == 1, uint8_t, 
+                             std::conditional_t<sizeof(Key) == 2, uint16_t,
+                             std::conditional_t<sizeof(Key) == 4, uint32_t, uint64_t>>>;
+
+            key_bits bits;
+            std::memcpy(&bits, &key, sizeof(Key));
+
+            const char* const bytes = reinterpret_cast<const char*>(elements);
+
+#if defined(__AVX512BW__)
+            constexpr size_t per_vector = 64 / sizeof(Element);
+            constexpr size_t stride     = sizeof(Element) / sizeof(Key);
+
+            //One bit per key lane, set for lanes at the start of elements
+            constexpr uint64_t lanes = [] {
+                uint64_t result = 0;
+                for (size_t lane = 0; lane < 64 / sizeof(Key); lane += stride)
+                    result |= uint64_t(1) << lane;
+                return result;
+            }();
+
+            __m512i pattern;
+            if constexpr (sizeof(Key) == 1) pattern = _mm512_set1_epi8(static_cast<char>(bits));
+            if constexpr (sizeof(Key) == 2) pattern = _mm512_set1_epi16(static_cast<short>(bits));
+            if constexpr (sizeof(Key) == 4) pattern = _mm512_set1_epi32(static_cast<int>(bits));
+            if constexpr (sizeof(Key) == 8) pattern = _mm512_set1_epi64(static_cast<long long>(bits));
+
+            for (; index + per_vector <= count; index += per_vector) {
+                const __m512i block = _mm512_loadu_si512(bytes + index * sizeof(Element));
+
+                uint64_t matches;
+                if constexpr (sizeof(Key) == 1) matches = _mm512_cmpeq_epi8_mask(block, pattern);
+                if constexpr (sizeof(Key) == 2) matches = _mm512_cmpeq_epi16_mask(block, pattern);
+                if constexpr (sizeof(Key) == 4) matches = _mm512_cmpeq_epi32_mask(block, pattern);
+                if constexpr (sizeof(Key) == 8) matches = _mm512_cmpeq_epi64_mask(block, pattern);
+
+                if (matches &= lanes)
+                    return index + static_cast<size_t>(std::countr_zero(matches)) / stride;
+            }
+#else
+            constexpr size_t per_vector = 32 / sizeof(Element);
+
+            //One bit per byte, set for the first byte of each element
+            constexpr uint32_t lanes = [] {
+                uint32_t result = 0;
+                for (size_t byte = 0; byte < 32; byte += sizeof(Element))
+                    result |= uint32_t(1) << byte;
+                return result;
+            }();
+
+            __m256i pattern;
+            if constexpr (sizeof(Key) == 1) pattern = _mm256_set1_epi8(static_cast<char>(bits));
+            if constexpr (sizeof(Key) == 2) pattern = _mm256_set1_epi16(static_cast<short>(bits));
+            if constexpr (sizeof(Key) == 4) pattern = _mm256_set1_epi32(static_cast<int>(bits));
+            if constexpr (sizeof(Key) == 8) pattern = _mm256_set1_epi64x(static_cast<long long>(bits));
+
+            for (; index + per_vector <= count; index += per_vector) {
+                const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + index * sizeof(Element)));
+
+                __m256i equal;
+                if constexpr (sizeof(Key) == 1) equal = _mm256_cmpeq_epi8(block, pattern);
+                if constexpr (sizeof(Key) == 2) equal = _mm256_cmpeq_epi16(block, pattern);
+                if constexpr (sizeof(Key) == 4) equal = _mm256_cmpeq_epi32(block, pattern);
+                if constexpr (sizeof(Key) == 8) equal = _mm256_cmpeq_epi64(block, pattern);
+
+                if (const uint32_t matches = static_cast<uint32_t>(_mm256_movemask_epi8(equal)) & lanes)
+                    return index + static_cast<size_t>(std::countr_zero(matches)) / sizeof(Element);
+            }
+#endif
+        }
+#endif
+        for (; index != count; ++index)
+            if (_key_of<Element, Key>(elements[index]) == key)
+                return index;
+
+        return count;
+    }
+
+    //First element of a sequence of key and mapped value pairs whose key equals key, or its end if there is none.
+    //Note: Arithmetic and pointer keys of contiguous sequences are compared a vector at a time, see _find_key
+    template<class KeyEqual, class Container, class Key>
+    [[nodiscard]] constexpr auto _linear_find(Container& elements, const Key& key)
+    {
+        using iterator   = decltype(std::ranges::begin(elements));
+        using value_type = std::iter_value_t<iterator>;
+
+        //Note: Keys compared through KeyEqual other than std::equal_to cannot be compared by their bytes
+        constexpr bool scannable =
+            _scannable_key<Key> &&
+            std::contiguous_iterator<iterator> &&
+            std::is_standard_layout_v<value_type> &&
+            (std::is_same_v<KeyEqual, std::equal_to<Key>> || std::is_same_v<KeyEqual, std::equal_to<>>);
+
+        if constexpr (scannable) {
+            if (!std::is_constant_evaluated() && !std::ranges::empty(elements)) {
+                const auto first = std::ranges::begin(elements);
+                return first + static_cast<std::iter_difference_t<iterator>>(_find_key(std::to_address(first), std::ranges::size(elements), key));
+            }
+        }
+
+        return std::ranges::find(elements, key, &value_type::first);
+    }
+
+
+    //////////////////////////////////////LINEAR MAP///////////////////////////////////////////////////////////////////////////////
+
+
     template<
         class KeyType,
         class MappedType,
@@ -40,9 +197,10 @@ namespace expu {
             return const_cast<linear_map&>(*this).find(key);
         }
 
+        //Note: Arithmetic and pointer keys of contiguous containers are compared a vector at a time, see _linear_find
         [[nodiscard]] constexpr iterator find(const key_type& key)
         {
-            return std::ranges::find(*this, key, &value_type::first);
+            return _linear_find<key_equal>(_elements, key);
         }
 
     public: // Indexing functions
@@ -58,7 +216,7 @@ namespace expu {
 
         [[nodiscard]] constexpr mapped_type& at(const key_type& key)
         {
-            return const_cast<value_type&>(static_cast<const linear_map&>(*this).at(key));
+            return const_cast<mapped_type&>(static_cast<const linear_map&>(*this).at(key));
         }
 
         [[nodiscard]] constexpr const mapped_type& operator[](const key_type& key) const
@@ -0,0 +1,526 @@
+#ifndef EXPU_PACKED_ARRAY_HPP_INCLUDED
+#define EXPU_PACKED_ARRAY_HPP_INCLUDED
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "expu/containers/darray.hpp"
+#include "expu/containers/fixed_array.hpp"
+
+#include "expu/maths/bit_utils.hpp"
+
+#include "expu/debug.hpp"
+
+namespace expu {
+
+    template<size_t Bits>
+    concept _packable_bits = 0 < Bits && Bits < _bit_word_bits;
+
+    //Smallest unsigned type holding Bits wide values.
+    template<size_t Bits>
+    using _packed_value_t = std::conditional_t<Bits <= 32, uint32_t, uint64_t>;
+
+    template<size_t Bits>
+    inline constexpr _bit_word _packed_mask = (_bit_word(1) << Bits) - 1;
+
+    //Reads the Bits wide value starting at bit offset of words, which may straddle two words.
+    template<size_t Bits>
+    [[nodiscard]] constexpr _bit_word _read_packed(const _bit_word* const words, const size_t offset) noexcept
+    {
+        const size_t index = offset >> _bit_word_shift;
+        const size_t shift = offset & (_bit_word_bits - 1);
+
+        _bit_word value = words[index] >> shift;
+
+        if (_bit_word_bits < shift + Bits)
+            value |= words[index + 1] << (_bit_word_bits - shift);
+
+        return value & _packed_mask<Bits>;
+    }
+
+    template<size_t Bits>
+    constexpr void _write_packed(_bit_word* const words, const size_t offset, const _bit_word value) noexcept
+    {
+        const size_t index = offset >> _bit_word_shift;
+        const size_t shift = offset & (_bit_word_bits - 1);
+
+        words[index] = (words[index] & ~(_packed_mask<Bits> << shift)) | (value << shift);
+
+        if (_bit_word_bits < shift + Bits) {
+            const size_t written = _bit_word_bits - shift;
+            words[index + 1] = (words[index + 1] & ~(_packed_mask<Bits> >> written)) | (value >> written);
+        }
+    }
+
+    //Packs count values from first into zeroed words, accumulating whole words before writing them.
+    template<size_t Bits, std::input_iterator InputIt>
+    constexpr void _pack_values(_bit_word* words, InputIt first, size_t count) noexcept
+    {
+        _bit_word buffer = 0;
+        size_t    filled = 0;
+
+        for (; count; --count, ++first) {
+            const _bit_word value = static_cast<_bit_word>(*first);
+            EXPU_VERIFY_DEBUG(value <= _packed_mask<Bits>, "Value is too large to be packed!");
+
+            buffer |= value << filled;
+            filled += Bits;
+
+            if (_bit_word_bits <= filled) {
+                *words++ = buffer;
+                filled -= _bit_word_bits;
+
+                //Note: Upper bits of the value which did not fit in the written word
+                buffer = filled ? value >> (Bits - filled) : 0;
+            }
+        }
+
+        if (filled)
+            *words = buffer;
+    }
+
+    //Unpacks count values from words into out.
+    //Note: Loads upto 4 bytes past the last value, hence words must be padded by at least one word.
+    template<size_t Bits>
+    void _unpack_values(const _bit_word* const words, const size_t count, uint32_t* const out) noexcept
+    {
+        static_assert(Bits <= 32);
+
+        size_t index = 0;
+
+#if defined(__AVX2__)
+        //Note: Each lane gathers the 4 bytes containing its value, which must fit in 32 bits after the byte's shift
+        if constexpr (Bits <= 25) {
+            const char* const bytes = reinterpret_cast<const char*>(words);
+
+            const __m256i lane_offsets = _mm256_setr_epi32(0, Bits, 2 * Bits, 3 * Bits, 4 * Bits, 5 * Bits, 6 * Bits, 7 * Bits);
+            const __m256i byte_shifts  = _mm256_set1_epi32(7);
+            const __m256i value_mask   = _mm256_set1_epi32(static_cast<int>(_packed_mask<Bits>));
+
+            for (; index + 8 <= count; index += 8) {
+                const size_t first_bit = index * Bits;
+
+                const __m256i offsets  = _mm256_add_epi32(lane_offsets, _mm256_set1_epi32(static_cast<int>(first_bit & 7)));
+                const __m256i gathered = _mm256_i32gather_epi32(reinterpret_cast<const int*>(bytes + (first_bit >> 3)), _mm256_srli_epi32(offsets, 3), 1);
+                const __m256i values   = _mm256_and_si256(_mm256_srlv_epi32(gathered, _mm256_and_si256(offsets, byte_shifts)), value_mask);
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + index), values);
+            }
+        }
+#endif
+        for (; index < count; ++index)
+            out[index] = static_cast<uint32_t>(_read_packed<Bits>(words, index * Bits));
+    }
+
+
+    //////////////////////////////////////PACKED REFERENCES AND ITERATORS///////////////////////////////////////////////////////////////////////////////
+
+
+    template<size_t Bits>
+    class _const_packed_index
+    {
+        template<size_t>
+        friend class _packed_const_iterator;
+
+    public:
+        using value_type = _packed_value_t<Bits>;
+
+    public:
+        constexpr _const_packed_index(_bit_word* const ptr, const size_t offset) noexcept:
+            _ptr(ptr), _offset(offset)
+        {
+            EXPU_VERIFY_DEBUG(offset < _bit_word_bits, "Offset is too large!");
+        }
+
+    public:
+        constexpr operator value_type() const noexcept
+        {
+            return static_cast<value_type>(_read_packed<Bits>(_ptr, _offset));
+        }
+
+    protected:
+        _bit_word* _ptr;
+        size_t     _offset; //Offset of the value's first bit within *_ptr
+    };
+
+    template<size_t Bits>
+    class _packed_index : public _const_packed_index<Bits>
+    {
+    private:
+        using _base_t = _const_packed_index<Bits>;
+
+    public:
+        using typename _base_t::value_type;
+        using _base_t::_base_t;
+
+        constexpr _packed_index(const _packed_index&) = default;
+
+    public:
+        constexpr _packed_index& operator=(const value_type value) noexcept
+        {
+            EXPU_VERIFY_DEBUG(value <= _packed_mask<Bits>, "Value is too large to be packed!");
+
+            _write_packed<Bits>(_base_t::_ptr, _base_t::_offset, value);
+            return *this;
+        }
+
+        //Note: Assigns the referenced value, as with _bool_index
+        constexpr _packed_index& operator=(const _packed_index& other) noexcept
+        {
+            return this->operator=(static_cast<value_type>(other));
+        }
+    };
+
+    //Random access iterator over Bits wide values, as a (word, bit offset) pair.
+    template<size_t Bits>
+    class _packed_const_iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = _packed_value_t<Bits>;
+        using reference         = _const_packed_index<Bits>;
+        using difference_type   = ptrdiff_t;
+
+    public:
+        constexpr _packed_const_iterator() noexcept:
+            _index(nullptr, 0) {}
+
+        constexpr _packed_const_iterator(_bit_word* const ptr, const size_t index) noexcept:
+            _index(ptr + ((index * Bits) >> _bit_word_shift), (index * Bits) & (_bit_word_bits - 1)) {}
+
+        constexpr _packed_const_iterator(const _packed_const_iterator&) = default;
+
+    public:
+        //Note: _packed_index assigns through, hence the position is copied member-wise
+        constexpr _packed_const_iterator& operator=(const _packed_const_iterator& other) noexcept
+        {
+            _index._ptr    = other._index._ptr;
+            _index._offset = other._index._offset;
+
+            return *this;
+        }
+
+    public:
+        [[nodiscard]] constexpr reference operator*() const noexcept { return _index; }
+
+        [[nodiscard]] constexpr reference operator[](const difference_type n) const noexcept
+        {
+            return *(*this + n);
+        }
+
+    public:
+        constexpr _packed_const_iterator& operator++() noexcept
+        {
+            _index._offset += Bits;
+            _index._ptr    += _index._offset >> _bit_word_shift;
+            _index._offset &= _bit_word_bits - 1;
+
+            return *this;
+        }
+
+        constexpr _packed_const_iterator& operator--() noexcept
+        {
+            return this->operator+=(-1);
+        }
+
+        constexpr _packed_const_iterator& operator+=(const difference_type n) noexcept
+        {
+            //Note: Right shifting a negative position rounds towards negative infinity
+            const difference_type position = static_cast<difference_type>(_index._offset) + n * static_cast<difference_type>(Bits);
+
+            _index._ptr   += position >> _bit_word_shift;
+            _index._offset = static_cast<size_t>(position & (_bit_word_bits - 1));
+
+            return *this;
+        }
+
+        constexpr _packed_const_iterator& operator-=(const difference_type n) noexcept
+        {
+            return this->operator+=(-n);
+        }
+
+    public: //Word-level access, used by bulk algorithms
+        [[nodiscard]] constexpr _bit_word* _word()   const noexcept { return _index._ptr; }
+        [[nodiscard]] constexpr size_t     _offset() const noexcept { return _index._offset; }
+
+    public:
+        [[nodiscard]] friend constexpr _packed_const_iterator operator+(_packed_const_iterator iter, const difference_type n) noexcept
+        {
+            return iter += n;
+        }
+
+        [[nodiscard]] friend constexpr _packed_const_iterator operator+(const difference_type n, _packed_const_iterator iter) noexcept
+        {
+            return iter += n;
+        }
+
+        [[nodiscard]] friend constexpr _packed_const_iterator operator-(_packed_const_iterator iter, const difference_type n) noexcept
+        {
+            return iter -= n;
+        }
+
+        [[nodiscard]] friend constexpr _packed_const_iterator operator++(_packed_const_iterator& iter, int) noexcept
+        {
+            const _packed_const_iterator copy(iter);
+            ++iter;
+            return copy;
+        }
+
+        [[nodiscard]] friend constexpr _packed_const_iterator operator--(_packed_const_iterator& iter, int) noexcept
+        {
+            const _packed_const_iterator copy(iter);
+            --iter;
+            return copy;
+        }
+
+        [[nodiscard]] friend constexpr difference_type operator-(const _packed_const_iterator& lhs, const _packed_const_iterator& rhs) noexcept
+        {
+            const difference_type bits = (lhs._word() - rhs._word()) * static_cast<difference_type>(_bit_word_bits) +
+                static_cast<difference_type>(lhs._offset()) - static_cast<difference_type>(rhs._offset());
+
+            return bits / static_cast<difference_type>(Bits);
+        }
+
+        [[nodiscard]] friend constexpr auto operator<=>(const _packed_const_iterator& lhs, const _packed_const_iterator& rhs) noexcept
+        {
+            if (lhs._word() == rhs._word())
+                return lhs._offset() <=> rhs._offset();
+            else
+                return lhs._word() <=> rhs._word();
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(const _packed_const_iterator& lhs, const _packed_const_iterator& rhs) noexcept
+        {
+            return lhs._word() == rhs._word() && lhs._offset() == rhs._offset();
+        }
+
+    protected:
+        _packed_index<Bits> _index;
+    };
+
+    template<size_t Bits>
+    class _packed_iterator : public _packed_const_iterator<Bits>
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = _packed_value_t<Bits>;
+        using reference         = _packed_index<Bits>;
+        using difference_type   = ptrdiff_t;
+
+    private:
+        using _base_t = _packed_const_iterator<Bits>;
+
+    public:
+        using _base_t::_base_t;
+
+    public:
+        [[nodiscard]] constexpr reference operator*() const noexcept { return _base_t::_index; }
+
+        [[nodiscard]] constexpr reference operator[](const difference_type n) const noexcept
+        {
+            return *(*this + n);
+        }
+
+    public:
+        constexpr _packed_iterator& operator++() noexcept
+        {
+            _base_t::operator++();
+            return *this;
+        }
+
+        constexpr _packed_iterator& operator--() noexcept
+        {
+            _base_t::operator--();
+            return *this;
+        }
+
+        constexpr _packed_iterator& operator+=(const difference_type n) noexcept
+        {
+            _base_t::operator+=(n);
+            return *this;
+        }
+
+        constexpr _packed_iterator& operator-=(const difference_type n) noexcept
+        {
+            _base_t::operator-=(n);
+            return *this;
+        }
+
+    public:
+        [[nodiscard]] friend constexpr _packed_iterator operator+(_packed_iterator iter, const difference_type n) noexcept
+        {
+            return iter += n;
+        }
+
+        [[nodiscard]] friend constexpr _packed_iterator operator+(const difference_type n, _packed_iterator iter) noexcept
+        {
+            return iter += n;
+        }
+
+        [[nodiscard]] friend constexpr _packed_iterator operator-(_packed_iterator iter, const difference_type n) noexcept
+        {
+            return iter -= n;
+        }
+
+        [[nodiscard]] friend constexpr _packed_iterator operator++(_packed_iterator& iter, int) noexcept
+        {
+            const _packed_iterator copy(iter);
+            ++iter;
+            return copy;
+        }
+
+        [[nodiscard]] friend constexpr _packed_iterator operator--(_packed_iterator& iter, int) noexcept
+        {
+            const _packed_iterator copy(iter);
+            --iter;
+            return copy;
+        }
+    };
+
+
+    //////////////////////////////////////PACKED ARRAY///////////////////////////////////////////////////////////////////////////////
+
+
+    //Fixed size array of unsigned Bits wide values, packed back to back in 64-bit words, generalising the packed
+    //storage of fixed_array<bool>. Elements are accessed through proxy references, as with fixed_array<bool>.
+    //Note: Words are allocated through Alloc, and padded by one word past the last element for bulk unpacking.
+    template<size_t Bits, class Alloc = std::allocator<_bit_word>>
+    requires(_packable_bits<Bits>)
+    class packed_array
+    {
+    public:
+        using allocator_type  = Alloc;
+        using value_type      = _packed_value_t<Bits>;
+        using size_type       = size_t;
+        using difference_type = ptrdiff_t;
+
+        using reference       = _packed_index<Bits>;
+        using const_reference = _const_packed_index<Bits>;
+
+        using iterator        = _packed_iterator<Bits>;
+        using const_iterator  = _packed_const_iterator<Bits>;
+
+        static constexpr size_t     bits      = Bits;
+        static constexpr value_type max_value = static_cast<value_type>(_packed_mask<Bits>);
+
+    private:
+        [[nodiscard]] static constexpr size_type _storage_words(const size_type size) noexcept
+        {
+            return _bit_word_count(size * Bits) + 1;
+        }
+
+    public:
+        explicit packed_array(const size_type n, const value_type value = 0, const Alloc& alloc = Alloc()):
+            _words(_storage_words(n), 0, alloc),
+            _size(n)
+        {
+            if (value)
+                for (reference element : *this)
+                    element = value;
+        }
+
+        template<std::forward_iterator FwdIt, std::sentinel_for<FwdIt> Sentinel>
+        packed_array(FwdIt first, const Sentinel last, const Alloc& alloc = Alloc()):
+            packed_array(static_cast<size_type>(std::ranges::distance(first, last)), 0, alloc)
+        {
+            _pack_values<Bits>(_first(), first, _size);
+        }
+
+        packed_array(const packed_array& other) = default;
+
+        //Note: Moved-from arrays are left empty, as their words are
+        packed_array(packed_array&& other) noexcept:
+            _words(std::move(other._words)),
+            _size(std::exchange(other._size, 0)) {}
+
+        packed_array& operator=(const packed_array& other) = default;
+
+        packed_array& operator=(packed_array&& other)
+            noexcept(std::is_nothrow_move_assignable_v<fixed_array<_bit_word, Alloc>>)
+        {
+            _words = std::move(other._words);
+            _size  = std::exchange(other._size, 0);
+
+            return *this;
+        }
+
+    private:
+        [[nodiscard]] _bit_word* _first() const noexcept
+        {
+            //Note: Words are never const objects, only viewed as const through const members
+            return const_cast<_bit_word*>(std::to_address(_words.begin()));
+        }
+
+    public:
+        [[nodiscard]] const_reference operator[](const size_type index) const noexcept
+        {
+            EXPU_VERIFY_DEBUG(index < size(), "Index out of range!");
+            return *(cbegin() + static_cast<difference_type>(index));
+        }
+
+        [[nodiscard]] reference operator[](const size_type index) noexcept
+        {
+            EXPU_VERIFY_DEBUG(index < size(), "Index out of range!");
+            return *(begin() + static_cast<difference_type>(index));
+        }
+
+    public:
+        //Copies every value into out, which must hold size() values.
+        void unpack_into(const std::span<uint32_t> out) const noexcept requires(Bits <= 32)
+        {
+            EXPU_VERIFY_DEBUG(size() <= out.size(), "Output range is too small!");
+            _unpack_values<Bits>(_first(), _size, out.data());
+        }
+
+        template<class DArrayAlloc = std::allocator<uint32_t>>
+        [[nodiscard]] darray<uint32_t, DArrayAlloc> unpack(const DArrayAlloc& alloc = DArrayAlloc()) const requires(Bits <= 32)
+        {
+            darray<uint32_t, DArrayAlloc> result(alloc);
+            unpack_into(result.append_for_overwrite(_size));
+
+            return result;
+        }
+
+        //Packs values, overwriting the first values.size() elements.
+        void pack(const std::span<const uint32_t> values) noexcept requires(Bits <= 32)
+        {
+            EXPU_VERIFY_DEBUG(values.size() <= size(), "Input range is too large!");
+
+            const size_type whole_words = (values.size() * Bits) >> _bit_word_shift;
+            const size_type tail_bits   = (values.size() * Bits) & (_bit_word_bits - 1);
+
+            //Note: Keeps the elements following the packed values, sharing the last partial word
+            const _bit_word kept = tail_bits ? _first()[whole_words] & ~_bit_tail_mask(tail_bits) : 0;
+
+            std::fill_n(_first(), _bit_word_count(values.size() * Bits), _bit_word(0));
+            _pack_values<Bits>(_first(), values.begin(), values.size());
+
+            if (tail_bits)
+                _first()[whole_words] |= kept;
+        }
+
+    public:
+        [[nodiscard]] iterator       begin()        noexcept { return iterator(_first(), 0); }
+        [[nodiscard]] const_iterator begin()  const noexcept { return cbegin(); }
+        [[nodiscard]] const_iterator cbegin() const noexcept { return const_iterator(_first(), 0); }
+
+        [[nodiscard]] iterator       end()        noexcept { return iterator(_first(), _size); }
+        [[nodiscard]] const_iterator end()  const noexcept { return cend(); }
+        [[nodiscard]] const_iterator cend() const noexcept { return const_iterator(_first(), _size); }
+
+        [[nodiscard]] size_type size()  const noexcept { return _size;  }
+        [[nodiscard]] bool      empty() const noexcept { return !_size; }
+
+    private:
+        fixed_array<_bit_word, Alloc> _words;
+        size_type _size;
+    };
+}
+
+#endif // !EXPU_PACKED_ARRAY_HPP_INCLUDED
@@ -0,0 +1,147 @@
+#ifndef EXPU_RANK_SELECT_HPP_INCLUDED
+#define EXPU_RANK_SELECT_HPP_INCLUDED
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "expu/containers/darray.hpp"
+#include "expu/containers/fixed_array.hpp"
+
+#include "expu/maths/bit_utils.hpp"
+
+namespace expu {
+
+    //Succinct rank/select index over a fixed_array<bool>, answering "how many elements before pos are set" in O(1)
+    //and "where is the k-th set element" in near O(1) time.
+    //Set bits are counted per superblock (2^16 bits, 64-bit absolute counts) and per block (512 bits, 16-bit counts
+    //relative to their superblock), adding ~3.2% to the size of the bitmap. The position of every
+    //_select_sample_rate-th set bit is sampled, narrowing select's search down to a few blocks.
+    //Note: The index refers to the bitmap's memory, hence is invalidated when the bitmap is modified or destroyed.
+    class rank_select
+    {
+    public:
+        using size_type = size_t;
+
+    private:
+        static constexpr unsigned char _block_shift      = 9;
+        static constexpr unsigned char _superblock_shift = 16;
+
+        static constexpr size_type _block_words          = size_type(1) << (_block_shift - _bit_word_shift);
+        static constexpr size_type _superblock_blocks    = size_type(1) << (_superblock_shift - _block_shift);
+        static constexpr size_type _select_sample_rate   = 4096;
+
+    public:
+        template<class Alloc>
+        explicit rank_select(const fixed_array<bool, Alloc>& bits):
+            _words(bits.begin()._word()),
+            _size(bits.size()),
+            _superblock_ranks(right_shift_round_up(bits.size(), _superblock_shift), 0),
+            _block_ranks(right_shift_round_up(bits.size(), _block_shift), 0)
+        {
+            _build();
+        }
+
+    private:
+        //Fills in the rank tables and select samples in a single pass over the bitmap
+        void _build()
+        {
+            const size_type word_count = _bit_word_count(_size);
+
+            size_type rank = 0;
+            size_type next_sample = 0;
+
+            for (size_type block = 0; block != _block_ranks.size(); ++block) {
+                if (block % _superblock_blocks == 0)
+                    _superblock_ranks[block / _superblock_blocks] = rank;
+
+                _block_ranks[block] = static_cast<uint16_t>(rank - _superblock_ranks[block / _superblock_blocks]);
+
+                const size_type first_word = block * _block_words;
+                const size_type block_rank = rank + _count_words(_words + first_word, std::min(_block_words, word_count - first_word));
+
+                //Sample blocks containing every _select_sample_rate-th set bit
+                for (; next_sample < block_rank; next_sample += _select_sample_rate)
+                    _select_samples.push_back(block);
+
+                rank = block_rank;
+            }
+
+            _count = rank;
+        }
+
+        [[nodiscard]] size_type _block_rank(const size_type block) const noexcept
+        {
+            return static_cast<size_type>(_superblock_ranks[block / _superblock_blocks]) + _block_ranks[block];
+        }
+
+    public:
+        //Number of set elements in [0, pos).
+        [[nodiscard]] size_type rank(const size_type pos) const noexcept
+        {
+            if (_size <= pos)
+                return _count;
+
+            const size_type word  = pos >> _bit_word_shift;
+            const size_type block = pos >> _block_shift;
+
+            size_type result = _block_rank(block);
+
+            for (size_type index = block * _block_words; index != word; ++index)
+                result += static_cast<size_type>(std::popcount(_words[index]));
+
+            const _bit_word preceding = (_bit_word(1) << (pos & (_bit_word_bits - 1))) - 1;
+            return result + static_cast<size_type>(std::popcount(_words[word] & preceding));
+        }
+
+        //Position of the k-th (from 0) set element, or size() if fewer than k + 1 elements are set.
+        [[nodiscard]] size_type select(size_type k) const noexcept
+        {
+            if (_count <= k)
+                return _size;
+
+            //The k-th set bit lies in the last block, between neighbouring samples, whose rank does not exceed k
+            const size_type sample = k / _select_sample_rate;
+
+            size_type first_block = _select_samples[sample];
+            size_type last_block  = sample + 1 < _select_samples.size() ? _select_samples[sample + 1] + 1 : _block_ranks.size();
+
+            while (1 < last_block - first_block) {
+                const size_type middle = first_block + (last_block - first_block) / 2;
+
+                if (_block_rank(middle) <= k)
+                    first_block = middle;
+                else
+                    last_block = middle;
+            }
+
+            k -= _block_rank(first_block);
+
+            for (size_type index = first_block * _block_words; ; ++index) {
+                const auto word_rank = static_cast<size_type>(std::popcount(_words[index]));
+
+                if (k < word_rank)
+                    return (index << _bit_word_shift) + _select_in_word(_words[index], k);
+
+                k -= word_rank;
+            }
+        }
+
+    public:
+        //Total number of set elements.
+        [[nodiscard]] size_type count() const noexcept { return _count; }
+        [[nodiscard]] size_type size()  const noexcept { return _size;  }
+
+    private:
+        const _bit_word* _words;
+        size_type _size;
+        size_type _count = 0;
+
+        fixed_array<uint64_t> _superblock_ranks;
+        fixed_array<uint16_t> _block_ranks;
+        darray<size_type>     _select_samples;
+    };
+}
+
+#endif // !EXPU_RANK_SELECT_HPP_INCLUDED
@@ -0,0 +1,735 @@
+#ifndef EXPU_ROARING_BITMAP_HPP_INCLUDED
+#define EXPU_ROARING_BITMAP_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+
+#include "expu/containers/darray.hpp"
+#include "expu/containers/fixed_array.hpp"
+
+#include "expu/maths/bit_utils.hpp"
+
+namespace expu {
+
+    //Positions are split into a 16-bit chunk key and 16 low bits, indexing into the chunk's container.
+    inline constexpr size_t _roaring_chunk_shift = 16;
+    inline constexpr size_t _roaring_chunk_bits  = size_t(1) << _roaring_chunk_shift;
+    inline constexpr size_t _roaring_chunk_words = _roaring_chunk_bits >> _bit_word_shift;
+
+    //Past this cardinality, arrays take more space than a bitmap of the whole chunk.
+    inline constexpr size_t _roaring_max_array   = _roaring_chunk_bits / 16;
+
+    using _roaring_chunk = std::array<_bit_word, _roaring_chunk_words>;
+
+    //Set of 16-bit values, stored as either a sorted array of values, a bitmap of the whole chunk or a sorted
+    //array of runs of consecutive values (pairs of first value and length - 1).
+    class _roaring_container
+    {
+    public:
+        enum class kind : unsigned char { array, bitmap, run };
+
+    private:
+        //Number of runs of consecutive bits set in words.
+        [[nodiscard]] static size_t _count_runs(const _bit_word* const words) noexcept
+        {
+            size_t runs = 0;
+            _bit_word carry = 0;
+
+            for (size_t index = 0; index != _roaring_chunk_words; ++index) {
+                const _bit_word word = words[index];
+
+                //Note: Runs begin at set bits whose preceding bit is unset
+                runs += static_cast<size_t>(std::popcount(word & ~((word << 1) | carry)));
+                carry = word >> (_bit_word_bits - 1);
+            }
+
+            return runs;
+        }
+
+        void _assign_array(const _bit_word* const words)
+        {
+            _kind = kind::array;
+            _values = darray<uint16_t>();
+
+            const std::span<uint16_t> values = _values.append_for_overwrite(_cardinality);
+            size_t out = 0;
+
+            for (size_t index = 0; index != _roaring_chunk_words; ++index)
+                for (_bit_word word = words[index]; word; word &= word - 1)
+                    values[out++] = static_cast<uint16_t>((index << _bit_word_shift) + static_cast<size_t>(std::countr_zero(word)));
+
+            //Note: words may be the container's own bitmap
+            _words = darray<_bit_word>();
+        }
+
+        void _assign_bitmap(const _bit_word* const words)
+        {
+            _kind = kind::bitmap;
+            _values = darray<uint16_t>();
+            _words.assign(words, words + _roaring_chunk_words);
+        }
+
+        void _assign_runs(const _bit_word* const words, const size_t runs)
+        {
+            _kind = kind::run;
+            _words = darray<_bit_word>();
+            _values = darray<uint16_t>();
+            _values.reserve(2 * runs);
+
+            for (size_t first = _find_bit(words, 0, _roaring_chunk_bits, true); first != _roaring_chunk_bits; ) {
+                const size_t last = _find_bit(words, first, _roaring_chunk_bits, false);
+
+                _values.push_back(static_cast<uint16_t>(first));
+                _values.push_back(static_cast<uint16_t>(last - first - 1));
+
+                first = _find_bit(words, last, _roaring_chunk_bits, true);
+            }
+        }
+
+    public:
+        //Builds the smallest container holding the bits set in the chunk words. If allow_runs is false, runs are
+        //not considered, as they must be converted before being modified.
+        [[nodiscard]] static _roaring_container from_words(const _bit_word* const words, const bool allow_runs = true)
+        {
+            _roaring_container result;
+            result._cardinality = static_cast<uint32_t>(_count_words(words, _roaring_chunk_words));
+
+            const size_t runs = allow_runs ? _count_runs(words) : _roaring_chunk_bits;
+
+            //Note: Compared in bytes, runs take 4 bytes, array values 2 and a bitmap 8KB regardless
+            if (4 * runs < std::min<size_t>(2 * result._cardinality, sizeof(_roaring_chunk)))
+                result._assign_runs(words, runs);
+            else if (result._cardinality <= _roaring_max_array)
+                result._assign_array(words);
+            else
+                result._assign_bitmap(words);
+
+            return result;
+        }
+
+    public:
+        //Sets the bits of the container's values in the chunk words.
+        void or_into(_bit_word* const words) const noexcept
+        {
+            switch (_kind) {
+            case kind::array:
+                for (const uint16_t value : _values)
+                    words[value >> _bit_word_shift] |= _bit_word(1) << (value & (_bit_word_bits - 1));
+                break;
+            case kind::bitmap:
+                _transform_words(words, words, std::to_address(_words.begin()), _roaring_chunk_words, _bit_or{});
+                break;
+            case kind::run:
+                for (size_t index = 0; index != _values.size(); index += 2)
+                    _set_bit_range(words, _values[index], size_t(_values[index]) + _values[index + 1] + 1);
+                break;
+            }
+        }
+
+        //Pointer to the container's bits, written to buffer unless stored as a bitmap.
+        [[nodiscard]] const _bit_word* words(_roaring_chunk& buffer) const noexcept
+        {
+            if (_kind == kind::bitmap)
+                return std::to_address(_words.begin());
+
+            buffer.fill(0);
+            or_into(buffer.data());
+
+            return buffer.data();
+        }
+
+    private:
+        //Index of the last run starting at or before value, or -1 if none.
+        [[nodiscard]] ptrdiff_t _run_before(const size_t value) const noexcept
+        {
+            size_t first = 0, last = _values.size() / 2;
+
+            while (first != last) {
+                const size_t middle = first + (last - first) / 2;
+
+                if (_values[2 * middle] <= value)
+                    first = middle + 1;
+                else
+                    last = middle;
+            }
+
+            return static_cast<ptrdiff_t>(first) - 1;
+        }
+
+    public:
+        [[nodiscard]] bool contains(const uint16_t value) const noexcept
+        {
+            switch (_kind) {
+            case kind::array:
+                return std::binary_search(_values.begin(), _values.end(), value);
+            case kind::bitmap:
+                return (_words[value >> _bit_word_shift] >> (value & (_bit_word_bits - 1))) & 1;
+            default:
+                const ptrdiff_t run = _run_before(value);
+                return 0 <= run && value - _values[2 * run] <= _values[2 * run + 1];
+            }
+        }
+
+        //First value not less than value, or _roaring_chunk_bits if none.
+        [[nodiscard]] size_t next(const size_t value) const noexcept
+        {
+            switch (_kind) {
+            case kind::array: {
+                const auto found = std::lower_bound(_values.begin(), _values.end(), value);
+                return found != _values.end() ? *found : _roaring_chunk_bits;
+            }
+            case kind::bitmap:
+                return _find_bit(std::to_address(_words.begin()), value, _roaring_chunk_bits, true);
+            default:
+                const ptrdiff_t run = _run_before(value);
+
+                if (0 <= run && value - _values[2 * run] <= _values[2 * run + 1])
+                    return value;
+
+                const size_t next_run = 2 * static_cast<size_t>(run + 1);
+                return next_run != _values.size() ? _values[next_run] : _roaring_chunk_bits;
+            }
+        }
+
+    private:
+        //Converts runs to an array or bitmap, which can be modified in place.
+        void _expand_runs()
+        {
+            if (_kind == kind::run) {
+                _roaring_chunk buffer;
+                *this = from_words(words(buffer), false);
+            }
+        }
+
+    public:
+        //Returns true if value was not already contained.
+        bool insert(const uint16_t value)
+        {
+            _expand_runs();
+
+            if (_kind == kind::array) {
+                const auto found = std::lower_bound(_values.begin(), _values.end(), value);
+                if (found != _values.end() && *found == value)
+                    return false;
+
+                if (_cardinality < _roaring_max_array) {
+                    _values.emplace(found, value);
+                    ++_cardinality;
+                    return true;
+                }
+
+                _roaring_chunk buffer;
+                _assign_bitmap(words(buffer));
+            }
+
+            _bit_word& word = _words[value >> _bit_word_shift];
+            const _bit_word mask = _bit_word(1) << (value & (_bit_word_bits - 1));
+
+            if (word & mask)
+                return false;
+
+            word |= mask;
+            ++_cardinality;
+            return true;
+        }
+
+        //Returns true if value was contained.
+        bool erase(const uint16_t value)
+        {
+            _expand_runs();
+
+            if (_kind == kind::array) {
+                const auto found = std::lower_bound(_values.begin(), _values.end(), value);
+                if (found == _values.end() || *found != value)
+                    return false;
+
+                _values.erase(found);
+                --_cardinality;
+                return true;
+            }
+
+            _bit_word& word = _words[value >> _bit_word_shift];
+            const _bit_word mask = _bit_word(1) << (value & (_bit_word_bits - 1));
+
+            if (!(word & mask))
+                return false;
+
+            word &= ~mask;
+
+            if (--_cardinality == _roaring_max_array)
+                _assign_array(std::to_address(_words.begin()));
+
+            return true;
+        }
+
+    public:
+        [[nodiscard]] static _roaring_container unite(const _roaring_container& lhs, const _roaring_container& rhs)
+        {
+            if (lhs._kind == kind::array && rhs._kind == kind::array && lhs._cardinality + rhs._cardinality <= _roaring_max_array) {
+                _roaring_container result;
+
+                const std::span<uint16_t> values = result._values.append_for_overwrite(lhs._cardinality + rhs._cardinality);
+                const auto last = std::set_union(lhs._values.begin(), lhs._values.end(), rhs._values.begin(), rhs._values.end(), values.begin());
+
+                result._cardinality = static_cast<uint32_t>(last - values.begin());
+                result._values.resize(result._cardinality);
+
+                return result;
+            }
+
+            _roaring_chunk buffer{};
+            lhs.or_into(buffer.data());
+            rhs.or_into(buffer.data());
+
+            return from_words(buffer.data());
+        }
+
+        //Note: Result may be empty
+        [[nodiscard]] static _roaring_container intersect(const _roaring_container& lhs, const _roaring_container& rhs)
+        {
+            //Arrays are intersected by probing the other container, which keeps the result an array
+            if (lhs._kind == kind::array || rhs._kind == kind::array) {
+                const _roaring_container& array = lhs._kind == kind::array ? lhs : rhs;
+                const _roaring_container& other = lhs._kind == kind::array ? rhs : lhs;
+
+                _roaring_container result;
+                const std::span<uint16_t> values = result._values.append_for_overwrite(array._cardinality);
+
+                auto last = values.begin();
+
+                if (other._kind == kind::array)
+                    last = std::set_intersection(array._values.begin(), array._values.end(), other._values.begin(), other._values.end(), last);
+                else
+                    last = std::copy_if(array._values.begin(), array._values.end(), last, [&other](const uint16_t value) { return other.contains(value); });
+
+                result._cardinality = static_cast<uint32_t>(last - values.begin());
+                result._values.resize(result._cardinality);
+
+                return result;
+            }
+
+            _roaring_chunk lhs_buffer, rhs_buffer;
+            const _bit_word* const rhs_words = rhs.words(rhs_buffer);
+
+            _transform_words(lhs_buffer.data(), lhs.words(lhs_buffer), rhs_words, _roaring_chunk_words, _bit_and{});
+
+            return from_words(lhs_buffer.data());
+        }
+
+    public:
+        [[nodiscard]] kind   type()        const noexcept { return _kind; }
+        [[nodiscard]] size_t cardinality() const noexcept { return _cardinality; }
+
+        //Heap memory used by the container in bytes.
+        [[nodiscard]] size_t memory_usage() const noexcept
+        {
+            return _values.capacity() * sizeof(uint16_t) + _words.capacity() * sizeof(_bit_word);
+        }
+
+    private:
+        kind     _kind        = kind::array;
+        uint32_t _cardinality = 0;
+
+        darray<uint16_t>  _values; //Values of array containers, pairs of (first, length - 1) of run containers
+        darray<_bit_word> _words;  //Words of bitmap containers
+    };
+
+
+    //////////////////////////////////////ROARING BITMAP///////////////////////////////////////////////////////////////////////////////
+
+
+    class roaring_bitmap;
+
+    class _roaring_reference
+    {
+    public:
+        constexpr _roaring_reference(roaring_bitmap& bitmap, const size_t pos) noexcept:
+            _bitmap(&bitmap), _pos(pos) {}
+
+        constexpr _roaring_reference(const _roaring_reference&) noexcept = default;
+
+    public:
+        inline _roaring_reference& operator=(const bool value);
+
+        //Note: Assigns through to the referenced element, as with _bool_index
+        _roaring_reference& operator=(const _roaring_reference& other)
+        {
+            return *this = static_cast<bool>(other);
+        }
+
+        inline operator bool() const noexcept;
+
+    private:
+        roaring_bitmap* _bitmap;
+        size_t          _pos;
+    };
+
+    //Iterates over the positions of set elements in increasing order.
+    class _roaring_const_iterator
+    {
+    public:
+        using iterator_concept  = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = size_t;
+        using difference_type   = ptrdiff_t;
+        using reference         = size_t;
+
+    public:
+        constexpr _roaring_const_iterator() noexcept = default;
+
+        constexpr _roaring_const_iterator(const roaring_bitmap* const bitmap, const size_t chunk, const size_t low) noexcept:
+            _bitmap(bitmap), _chunk(chunk), _low(low) {}
+
+    public:
+        [[nodiscard]] inline size_t operator*() const noexcept;
+
+        inline _roaring_const_iterator& operator++() noexcept;
+
+        _roaring_const_iterator operator++(int) noexcept
+        {
+            _roaring_const_iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const _roaring_const_iterator& other) const noexcept
+        {
+            return _chunk == other._chunk && _low == other._low;
+        }
+
+    private:
+        const roaring_bitmap* _bitmap = nullptr;
+        size_t _chunk = 0;
+        size_t _low   = 0;
+    };
+
+    //Compressed set of positions in [0, 2^32), an alternative to fixed_array<bool> for sparse or clustered bits.
+    //Positions are split into chunks of 2^16, each stored in the smallest of a sorted array (sparse chunks), a
+    //bitmap (dense chunks) or a sorted array of runs (clustered chunks). Empty chunks are not stored.
+    //Elements are accessed as with fixed_array<bool>, and iteration visits the positions of set elements.
+    //Note: Modifying a run container converts it to an array or bitmap, run_optimize() restores the smallest
+    //representation of every chunk.
+    class roaring_bitmap
+    {
+    public:
+        using size_type       = size_t;
+        using value_type      = bool;
+        using reference       = _roaring_reference;
+        using const_reference = bool;
+        using const_iterator  = _roaring_const_iterator;
+        using iterator        = const_iterator;
+
+        //One past the largest position, returned by searches which found no set element.
+        static constexpr size_type npos = size_type(1) << 32;
+
+    public:
+        roaring_bitmap() = default;
+
+        template<class Alloc>
+        explicit roaring_bitmap(const fixed_array<bool, Alloc>& bits)
+        {
+            EXPU_VERIFY_DEBUG(bits.size() <= npos, "expu::fixed_array is too large for expu::roaring_bitmap.");
+
+            const _bit_word* const words = bits.begin()._word();
+            const size_type word_count = _bit_word_count(bits.size());
+
+            for (size_type first_word = 0; first_word < word_count; first_word += _roaring_chunk_words) {
+                const size_type chunk_words = std::min(_roaring_chunk_words, word_count - first_word);
+
+                //Skips empty chunks before building their container
+                if (_skip_words(words, first_word, first_word + chunk_words, 0) == first_word + chunk_words)
+                    continue;
+
+                _roaring_container container;
+
+                if (chunk_words == _roaring_chunk_words)
+                    container = _roaring_container::from_words(words + first_word);
+                else {
+                    _roaring_chunk buffer{};
+                    std::copy_n(words + first_word, chunk_words, buffer.begin());
+
+                    container = _roaring_container::from_words(buffer.data());
+                }
+
+                _keys.push_back(static_cast<uint16_t>(first_word / _roaring_chunk_words));
+                _containers.push_back(std::move(container));
+            }
+        }
+
+    public:
+        //Dense copy of elements [0, size), elements past size are dropped.
+        template<class Alloc = std::allocator<bool>>
+        [[nodiscard]] fixed_array<bool, Alloc> to_fixed_array(const size_type size, const Alloc& alloc = Alloc()) const
+        {
+            fixed_array<bool, Alloc> result(size, false, alloc);
+            _bit_word* const words = result.begin()._word();
+
+            for (size_type index = 0; index != _keys.size(); ++index) {
+                const size_type first_bit = size_type(_keys[index]) << _roaring_chunk_shift;
+                if (size <= first_bit)
+                    break;
+
+                _bit_word* const chunk_words = words + (first_bit >> _bit_word_shift);
+
+                if (first_bit + _roaring_chunk_bits <= size)
+                    _containers[index].or_into(chunk_words);
+                else {
+                    //Note: Padding bits past size must remain unset
+                    _roaring_chunk buffer{};
+                    _containers[index].or_into(buffer.data());
+
+                    const size_type last_bit = size - first_bit;
+                    buffer[(last_bit - 1) >> _bit_word_shift] &= _bit_tail_mask(last_bit);
+
+                    std::copy_n(buffer.begin(), _bit_word_count(last_bit), chunk_words);
+                }
+            }
+
+            return result;
+        }
+
+    private:
+        [[nodiscard]] static constexpr uint16_t _key_of(const size_type pos) noexcept { return static_cast<uint16_t>(pos >> _roaring_chunk_shift); }
+        [[nodiscard]] static constexpr uint16_t _low_of(const size_type pos) noexcept { return static_cast<uint16_t>(pos); }
+
+        //Index of the first chunk whose key is not less than key.
+        [[nodiscard]] size_type _lower_chunk(const uint16_t key) const noexcept
+        {
+            return static_cast<size_type>(std::lower_bound(_keys.begin(), _keys.end(), key) - _keys.begin());
+        }
+
+        //Position of the first set element in chunks [chunk, ...) not less than low within its chunk.
+        [[nodiscard]] size_type _next_from(size_type chunk, size_type low) const noexcept
+        {
+            for (; chunk != _keys.size(); ++chunk, low = 0) {
+                const size_type found = _containers[chunk].next(low);
+
+                if (found != _roaring_chunk_bits)
+                    return (size_type(_keys[chunk]) << _roaring_chunk_shift) + found;
+            }
+
+            return npos;
+        }
+
+    public:
+        //Returns true if pos was not already set.
+        bool insert(const size_type pos)
+        {
+            EXPU_VERIFY_DEBUG(pos < npos, "Position out of range!");
+
+            const uint16_t key = _key_of(pos);
+            const size_type chunk = _lower_chunk(key);
+
+            if (chunk == _keys.size() || _keys[chunk] != key) {
+                _keys.emplace(_keys.begin() + chunk, key);
+                _containers.emplace(_containers.begin() + chunk);
+            }
+
+            return _containers[chunk].insert(_low_of(pos));
+        }
+
+        //Returns true if pos was set, hence false for positions past npos.
+        bool erase(const size_type pos)
+        {
+            if (npos <= pos)
+                return false;
+
+            const uint16_t key = _key_of(pos);
+            const size_type chunk = _lower_chunk(key);
+
+            if (chunk == _keys.size() || _keys[chunk] != key || !_containers[chunk].erase(_low_of(pos)))
+                return false;
+
+            if (!_containers[chunk].cardinality()) {
+                _keys.erase(_keys.begin() + chunk);
+                _containers.erase(_containers.begin() + chunk);
+            }
+
+            return true;
+        }
+
+        [[nodiscard]] bool contains(const size_type pos) const noexcept
+        {
+            const uint16_t key = _key_of(pos);
+            const size_type chunk = _lower_chunk(key);
+
+            return pos < npos && chunk != _keys.size() && _keys[chunk] == key && _containers[chunk].contains(_low_of(pos));
+        }
+
+        [[nodiscard]] bool      operator[](const size_type pos) const noexcept { return contains(pos); }
+        [[nodiscard]] reference operator[](const size_type pos)       noexcept { return reference(*this, pos); }
+
+    public:
+        //Number of set elements.
+        [[nodiscard]] size_type count() const noexcept
+        {
+            size_type result = 0;
+            for (const _roaring_container& container : _containers)
+                result += container.cardinality();
+
+            return result;
+        }
+
+        [[nodiscard]] bool any()  const noexcept { return !_keys.empty(); }
+        [[nodiscard]] bool none() const noexcept { return _keys.empty(); }
+
+        //Position of the first set element, or npos if none.
+        [[nodiscard]] size_type find_first() const noexcept
+        {
+            return _next_from(0, 0);
+        }
+
+        //Position of the first set element after pos, or npos if none.
+        [[nodiscard]] size_type find_next(const size_type pos) const noexcept
+        {
+            //Note: Compared before adding one, which would wrap for the largest positions
+            if (npos - 1 <= pos)
+                return npos;
+
+            const uint16_t key = _key_of(pos + 1);
+            const size_type chunk = _lower_chunk(key);
+
+            return _next_from(chunk, chunk != _keys.size() && _keys[chunk] == key ? _low_of(pos + 1) : 0);
+        }
+
+    public:
+        roaring_bitmap& operator|=(const roaring_bitmap& other)
+        {
+            roaring_bitmap result;
+            result._keys.reserve(_keys.size() + other._keys.size());
+            result._containers.reserve(_keys.size() + other._keys.size());
+
+            size_type index = 0, other_index = 0;
+
+            while (index != _keys.size() || other_index != other._keys.size()) {
+                if (other_index == other._keys.size() || (index != _keys.size() && _keys[index] < other._keys[other_index])) {
+                    result._keys.push_back(_keys[index]);
+                    result._containers.push_back(std::move(_containers[index++]));
+                }
+                else if (index == _keys.size() || other._keys[other_index] < _keys[index]) {
+                    result._keys.push_back(other._keys[other_index]);
+                    result._containers.push_back(other._containers[other_index++]);
+                }
+                else {
+                    result._keys.push_back(_keys[index]);
+                    result._containers.push_back(_roaring_container::unite(_containers[index++], other._containers[other_index++]));
+                }
+            }
+
+            return *this = std::move(result);
+        }
+
+        roaring_bitmap& operator&=(const roaring_bitmap& other)
+        {
+            roaring_bitmap result;
+            size_type index = 0, other_index = 0;
+
+            //Only chunks present in both may intersect
+            while (index != _keys.size() && other_index != other._keys.size()) {
+                if (_keys[index] < other._keys[other_index])
+                    ++index;
+                else if (other._keys[other_index] < _keys[index])
+                    ++other_index;
+                else {
+                    _roaring_container container = _roaring_container::intersect(_containers[index], other._containers[other_index]);
+
+                    if (container.cardinality()) {
+                        result._keys.push_back(_keys[index]);
+                        result._containers.push_back(std::move(container));
+                    }
+
+                    ++index, ++other_index;
+                }
+            }
+
+            return *this = std::move(result);
+        }
+
+        //Converts every chunk to its smallest representation.
+        void run_optimize()
+        {
+            _roaring_chunk buffer;
+
+            for (_roaring_container& container : _containers)
+                container = _roaring_container::from_words(container.words(buffer));
+        }
+
+        //Heap memory used by the bitmap in bytes.
+        [[nodiscard]] size_type memory_usage() const noexcept
+        {
+            size_type result = _keys.capacity() * sizeof(uint16_t) + _containers.capacity() * sizeof(_roaring_container);
+            for (const _roaring_container& container : _containers)
+                result += container.memory_usage();
+
+            return result;
+        }
+
+    public:
+        [[nodiscard]] const_iterator begin() const noexcept
+        {
+            const size_type first = find_first();
+            return first != npos ? const_iterator(this, 0, _low_of(first)) : end();
+        }
+
+        [[nodiscard]] const_iterator end() const noexcept { return const_iterator(this, _keys.size(), 0); }
+
+        [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+        [[nodiscard]] const_iterator cend()   const noexcept { return end();   }
+
+    private:
+        friend class _roaring_const_iterator;
+
+        darray<uint16_t>           _keys;       //Sorted keys of non-empty chunks
+        darray<_roaring_container> _containers; //Container of each key's chunk
+    };
+
+    inline _roaring_reference& _roaring_reference::operator=(const bool value)
+    {
+        if (value)
+            _bitmap->insert(_pos);
+        else
+            _bitmap->erase(_pos);
+
+        return *this;
+    }
+
+    inline _roaring_reference::operator bool() const noexcept
+    {
+        return _bitmap->contains(_pos);
+    }
+
+    inline size_t _roaring_const_iterator::operator*() const noexcept
+    {
+        return (size_t(_bitmap->_keys[_chunk]) << _roaring_chunk_shift) + _low;
+    }
+
+    inline _roaring_const_iterator& _roaring_const_iterator::operator++() noexcept
+    {
+        _low = _bitmap->_containers[_chunk].next(_low + 1);
+
+        //Note: Containers are never empty, hence the next chunk's first element is found by next(0)
+        if (_low == _roaring_chunk_bits && ++_chunk != _bitmap->_keys.size())
+            _low = _bitmap->_containers[_chunk].next(0);
+        else if (_low == _roaring_chunk_bits)
+            _low = 0;
+
+        return *this;
+    }
+
+    [[nodiscard]] inline roaring_bitmap operator|(roaring_bitmap lhs, const roaring_bitmap& rhs)
+    {
+        return lhs |= rhs;
+    }
+
+    [[nodiscard]] inline roaring_bitmap operator&(roaring_bitmap lhs, const roaring_bitmap& rhs)
+    {
+        return lhs &= rhs;
+    }
+}
+
+#endif // !EXPU_ROARING_BITMAP_HPP_INCLUDED
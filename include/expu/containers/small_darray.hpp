@@ -0,0 +1,762 @@
+#ifndef EXPU_CONTAINERS_SMALL_DARRAY_HPP_INCLUDED
+#define EXPU_CONTAINERS_SMALL_DARRAY_HPP_INCLUDED
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "expu/containers/contiguous_container.hpp"
+#include "expu/containers/darray.hpp"
+#include "expu/containers/growth_policy.hpp"
+
+#include "expu/debug.hpp"
+#include "expu/meta/meta_utils.hpp"
+#include "expu/mem_utils.hpp"
+
+namespace expu {
+
+    //Dynamic array which stores up to N elements inside the object itself, only allocating (through Alloc) once
+    //it outgrows them. Elements stored inline are constructed and destroyed through std::allocator, hence Alloc is
+    //only ever used to manage heap memory.
+    //Note: Unlike expu::darray, moving a small_darray whose elements are stored inline moves each element. The
+    //allocator is copied, rather than moved, as the moved-from array remains usable through its inline storage.
+    template<
+        class Type,
+        size_t N,
+        class Alloc = std::allocator<Type>,
+        class GrowthPolicy = geometric_growth<>>
+    class small_darray
+    {
+    private:
+        using _alloc_traits = std::allocator_traits<Alloc>;
+        using _inline_alloc_t = std::allocator<Type>;
+
+        //Ensure allocator value_type matches the container type
+        static_assert(std::is_same_v<Type, typename _alloc_traits::value_type>);
+        static_assert(std::is_same_v<Type*, typename _alloc_traits::pointer>, "Alloc must use raw pointers, such that inline elements may be addressed!");
+        static_assert(growth_policy<GrowthPolicy>, "GrowthPolicy must satisfy expu::growth_policy!");
+        static_assert(0 < N, "Use expu::darray if no inline capacity is required!");
+
+    //Essential typedefs (Container requirements)
+    public:
+        using allocator_type  = Alloc;
+        using value_type      = Type;
+        using reference       = Type&;
+        using const_reference = const Type&;
+        using pointer         = typename _alloc_traits::pointer;
+        using const_pointer   = typename _alloc_traits::const_pointer;
+        using difference_type = typename _alloc_traits::difference_type;
+        using size_type       = typename _alloc_traits::size_type;
+
+    private:
+        using _data_t = _darray_data<pointer, const_pointer>;
+
+    public:
+        using growth_policy_type = GrowthPolicy;
+
+        static constexpr size_type inline_capacity = N;
+
+    //Iterator typedefs
+    public:
+        using iterator       = ctg_iterator<_data_t>;
+        using const_iterator = ctg_const_iterator<_data_t>;
+
+    private:
+        //Note: Union avoids default constructing elements.
+        union _inline_storage
+        {
+            constexpr _inline_storage() noexcept {}
+            constexpr ~_inline_storage() noexcept {}
+
+            Type elements[N];
+        };
+
+    //Special constructors (and destructor)
+    public:
+        constexpr small_darray() noexcept(std::is_nothrow_default_constructible_v<Alloc>):
+            _cpair(zero_then_variadic{})
+        {
+            _reset_inline();
+        }
+
+        constexpr small_darray(const Alloc& new_alloc) noexcept:
+            _cpair(one_then_variadic{}, new_alloc)
+        {
+            _reset_inline();
+        }
+
+        constexpr small_darray(const small_darray& other, const Alloc& alloc):
+            small_darray(alloc)
+        {
+            assign(other.begin(), other.end());
+        }
+
+        constexpr small_darray(const small_darray& other):
+            small_darray(other, _alloc_traits::select_on_container_copy_construction(other._alloc())) {}
+
+        constexpr small_darray(small_darray&& other, const Alloc& alloc):
+            small_darray(alloc)
+        {
+            if (!other._is_inline() && _alloc_traits::is_always_equal::value) {
+                _steal(other);
+                return;
+            }
+
+            if constexpr (!_alloc_traits::is_always_equal::value) {
+                if (!other._is_inline() && _alloc() == other._alloc()) {
+                    _steal(other);
+                    return;
+                }
+            }
+
+            assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+            other.clear();
+        }
+
+        constexpr small_darray(small_darray&& other)
+            noexcept(is_trivially_relocatable_v<value_type> || std::is_nothrow_move_constructible_v<value_type>):
+            _cpair(one_then_variadic{}, std::as_const(other._alloc()))
+        {
+            _reset_inline();
+
+            if (!other._is_inline())
+                _steal(other);
+            else {
+                //Note: Both arrays are inline, hence other's elements are moved (or relocated) into this' buffer
+                _inline_alloc_t inline_alloc;
+
+                if constexpr (is_trivially_relocatable_v<value_type>)
+                    _data().last = uninitialised_relocate(inline_alloc, other._data().first, other._data().last, _data().first);
+                else {
+                    _data().last = uninitialised_move(inline_alloc, other._data().first, other._data().last, _data().first);
+                    destroy_range(inline_alloc, other._data().first, other._data().last);
+                }
+
+                other._data().last = other._data().first;
+            }
+        }
+
+        template<
+            std::input_iterator InputIt,
+            std::sentinel_for<InputIt> Sentinel>
+        constexpr small_darray(InputIt first, const Sentinel last, const Alloc& alloc = Alloc()):
+            small_darray(alloc)
+        {
+            assign(first, last);
+        }
+
+        constexpr ~small_darray() noexcept
+        {
+            _clear_dealloc();
+        }
+
+    private:
+        [[nodiscard]] constexpr pointer _inline_first() noexcept
+        {
+            return _storage.elements;
+        }
+
+        [[nodiscard]] constexpr bool _is_inline() const noexcept
+        {
+            return _data().first == _storage.elements;
+        }
+
+        constexpr void _reset_inline() noexcept
+        {
+            _data().first = _inline_first();
+            _data().last  = _data().first;
+            _data().end   = _data().first + N;
+        }
+
+        //Calls callable with the allocator responsible for the elements of this array.
+        template<class Callable>
+        constexpr decltype(auto) _visit_alloc(Callable&& callable)
+        {
+            if (_is_inline()) {
+                _inline_alloc_t inline_alloc;
+                return std::invoke(std::forward<Callable>(callable), inline_alloc);
+            }
+            else
+                return std::invoke(std::forward<Callable>(callable), _alloc());
+        }
+
+        //Takes ownership of other's heap memory, leaving other empty (and inline).
+        constexpr void _steal(small_darray& other) noexcept
+        {
+            _data().first = std::exchange(other._data().first, other._inline_first());
+            _data().last  = std::exchange(other._data().last , other._data().first);
+            _data().end   = std::exchange(other._data().end  , other._data().first + N);
+        }
+
+        constexpr void _clear_dealloc()
+            noexcept(std::is_nothrow_destructible_v<value_type>)
+        {
+            clear();
+
+            if (!_is_inline())
+                _alloc_traits::deallocate(_alloc(), _data().first, capacity());
+        }
+
+        //Replaces internal array by [new_first, new_last), deallocating old memory.
+        //Note: Elements of the old array must have already been destroyed (or relocated).
+        constexpr void _replace(const pointer new_first, const pointer new_last, const size_type new_capacity) noexcept
+        {
+            if (!_is_inline())
+                _alloc_traits::deallocate(_alloc(), _data().first, capacity());
+
+            _data().first = new_first;
+            _data().last  = new_last;
+            _data().end   = new_first + new_capacity;
+        }
+
+        //Moves [first, last) from the internal array into uninitialised output, which must be owned
+        //by dest_alloc. If a move could throw, copies instead, providing the strong guarantee.
+        template<class DestAlloc>
+        constexpr pointer _transfer(DestAlloc& dest_alloc, const pointer first, const pointer last, const pointer output)
+        {
+            if constexpr (is_trivially_relocatable_v<value_type>)
+                return _visit_alloc([&](auto& alloc) { return uninitialised_relocate(alloc, dest_alloc, first, last, output); });
+            else if constexpr (std::is_nothrow_move_constructible_v<value_type>)
+                return uninitialised_move(dest_alloc, first, last, output);
+            else
+                return uninitialised_copy(dest_alloc, first, last, output);
+        }
+
+        //Destroys the elements of the internal array, unless they have already been relocated by _transfer
+        constexpr void _destroy_transferred() noexcept
+        {
+            if constexpr (!is_trivially_relocatable_v<value_type>)
+                _visit_alloc([&](auto& alloc) { destroy_range(alloc, _data().first, _data().last); });
+        }
+
+        //Moves all elements into a new heap block of exactly new_capacity elements.
+        constexpr void _reallocate_exactly(const size_type new_capacity)
+        {
+            const pointer new_first = _alloc_traits::allocate(_alloc(), new_capacity);
+                  pointer new_last  = nullptr;
+
+            try {
+                new_last = _transfer(_alloc(), _data().first, _data().last, new_first);
+            }
+            catch (...) {
+                _alloc_traits::deallocate(_alloc(), new_first, new_capacity);
+                throw;
+            }
+
+            _destroy_transferred();
+            _replace(new_first, new_last, new_capacity);
+        }
+
+        constexpr size_type _calculate_growth(const size_type min_capacity) const
+        {
+            if (max_size() < min_capacity)
+                throw std::bad_array_new_length();
+
+            return static_cast<size_type>(GrowthPolicy::next_capacity(size(), min_capacity, max_size(), sizeof(value_type)));
+        }
+
+    public:
+        template<
+            std::input_iterator InputIt,
+            std::sentinel_for<InputIt> Sentinel>
+        constexpr small_darray& assign(InputIt first, const Sentinel last)
+        {
+            if constexpr (std::forward_iterator<InputIt>) {
+                const auto range_size = static_cast<size_type>(std::ranges::distance(first, last));
+
+                //Case 1: Not enough capacity to fit new range, allocate exactly enough.
+                if (capacity() < range_size) {
+                    const pointer new_first = _alloc_traits::allocate(_alloc(), range_size);
+                          pointer new_last  = nullptr;
+
+                    try {
+                        new_last = uninitialised_copy(_alloc(), first, last, new_first);
+                    }
+                    catch (...) {
+                        _alloc_traits::deallocate(_alloc(), new_first, range_size);
+                        throw;
+                    }
+
+                    clear();
+                    _replace(new_first, new_last, range_size);
+                }
+                //Case 2: Enough capacity, but new range greater than size. Copy assign, then uninit copy remaining.
+                else if (size() < range_size) {
+                    first = copy_until_sentinel(first, _data().first, _data().last);
+
+                    _visit_alloc([&](auto& alloc) { _data().last = uninitialised_copy(alloc, first, last, _data().last); });
+                }
+                //Case 3: New range smaller than size; assign range then destroy remaining.
+                else {
+                    const pointer new_last = copy(first, last, _data().first);
+                    _visit_alloc([&](auto& alloc) { destroy_range(alloc, new_last, _data().last); });
+
+                    _data().last = new_last;
+                }
+            }
+            else {
+                clear();
+
+                for (; first != last; ++first)
+                    emplace_back(*first);
+            }
+
+            return *this;
+        }
+
+        constexpr small_darray& operator=(const small_darray& other)
+        {
+            if (this == &other)
+                return *this;
+
+            if constexpr (_alloc_traits::propagate_on_container_copy_assignment::value) {
+                if constexpr (!_alloc_traits::is_always_equal::value) {
+                    //Heap memory cannot be deallocated by the new allocator
+                    if (_alloc() != other._alloc()) {
+                        _clear_dealloc();
+                        _reset_inline();
+                    }
+                }
+
+                _alloc() = other._alloc();
+            }
+
+            return assign(other.begin(), other.end());
+        }
+
+        constexpr small_darray& operator=(small_darray&& other)
+        {
+            if (this == &other)
+                return *this;
+
+            constexpr bool propagate = _alloc_traits::propagate_on_container_move_assignment::value;
+
+            if (!other._is_inline() && (propagate || _alloc_traits::is_always_equal::value || _alloc() == other._alloc())) {
+                _clear_dealloc();
+
+                if constexpr (propagate)
+                    _alloc() = std::as_const(other._alloc());
+
+                _steal(other);
+                return *this;
+            }
+
+            if constexpr (propagate && !_alloc_traits::is_always_equal::value) {
+                if (_alloc() != other._alloc()) {
+                    _clear_dealloc();
+                    _reset_inline();
+                }
+            }
+
+            if constexpr (propagate)
+                _alloc() = std::as_const(other._alloc());
+
+            assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+            other.clear();
+
+            return *this;
+        }
+
+    public:
+        constexpr void clear()
+            noexcept(std::is_nothrow_destructible_v<value_type>)
+        {
+            _visit_alloc([&](auto& alloc) { destroy_range(alloc, _data().first, _data().last); });
+            _data().last = _data().first;
+        }
+
+        constexpr iterator erase(const const_iterator first, const const_iterator last)
+            noexcept(is_trivially_relocatable_v<value_type> || std::is_nothrow_move_assignable_v<value_type>)
+        {
+            const pointer naked_first = first._unwrapped();
+            const pointer naked_last  = last._unwrapped();
+
+            EXPU_VERIFY_DEBUG((_data().first <= naked_first) && (naked_first <= naked_last) && (naked_last <= _data().last),
+                "Erase range does not lie within constructed range of the array!");
+
+            if (naked_first != naked_last) {
+                _visit_alloc([&](auto& alloc) {
+                    if constexpr (is_trivially_relocatable_v<value_type>) {
+                        destroy_range(alloc, naked_first, naked_last);
+                        _data().last = uninitialised_relocate(alloc, naked_last, _data().last, naked_first);
+                    }
+                    else {
+                        const pointer new_last = std::move(naked_last, _data().last, naked_first);
+                        destroy_range(alloc, new_last, _data().last);
+
+                        _data().last = new_last;
+                    }
+                });
+            }
+
+            return iterator(naked_first, &_data());
+        }
+
+        constexpr iterator erase(const const_iterator at)
+            noexcept(noexcept(erase(at, at)))
+        {
+            return erase(at, std::next(at));
+        }
+
+    public:
+        //Unchecked emplace_back
+        template<class ... Args>
+        constexpr void u_emplace_back(Args&& ... args)
+            noexcept(std::is_nothrow_constructible_v<value_type, Args...>)
+        {
+            EXPU_VERIFY_DEBUG(_data().last != _data().end, "Small darray has no remaining capacity!");
+
+            _visit_alloc([&](auto& alloc) {
+                std::allocator_traits<std::remove_reference_t<decltype(alloc)>>::construct(
+                    alloc, std::to_address(_data().last), std::forward<Args>(args)...);
+            });
+
+            ++_data().last;
+        }
+
+        constexpr void upush_back(const value_type& other)
+            noexcept(std::is_nothrow_copy_constructible_v<value_type>)
+        {
+            u_emplace_back(other);
+        }
+
+        constexpr void upush_back(value_type&& other)
+            noexcept(std::is_nothrow_move_constructible_v<value_type>)
+        {
+            u_emplace_back(std::move(other));
+        }
+
+        template<class ... Args>
+        constexpr iterator emplace(const const_iterator at, Args&& ... args)
+        {
+            const pointer naked_at = at._unwrapped();
+
+            EXPU_VERIFY_DEBUG((_data().first <= naked_at) && (naked_at <= _data().last),
+                "Emplace at pointer does not lie within constructed range (or one after the end) of the array!");
+
+            if (_data().last != _data().end) {
+                if (naked_at == _data().last)
+                    u_emplace_back(std::forward<Args>(args)...);
+                else {
+                    _visit_alloc([&](auto& alloc) {
+                        using alloc_traits = std::allocator_traits<std::remove_reference_t<decltype(alloc)>>;
+
+                        //Shift tail by one with a single memmove, then construct into the gap.
+                        if constexpr (is_trivially_relocatable_v<value_type>) {
+                            const pointer new_last = uninitialised_relocate(alloc, naked_at, _data().last, naked_at + 1);
+
+                            try {
+                                alloc_traits::construct(alloc, naked_at, std::forward<Args>(args)...);
+                            }
+                            catch (...) {
+                                uninitialised_relocate(alloc, naked_at + 1, new_last, naked_at);
+                                throw;
+                            }
+
+                            _data().last = new_last;
+                        }
+                        //Note: Constructing first ensures arguments referring to elements of this array remain valid.
+                        else {
+                            value_type value(std::forward<Args>(args)...);
+
+                            alloc_traits::construct(alloc, _data().last, std::move(*(_data().last - 1)));
+                            ++_data().last;
+
+                            std::move_backward(naked_at, _data().last - 2, _data().last - 1);
+                            *naked_at = std::move(value);
+                        }
+                    });
+                }
+
+                return iterator(naked_at, &_data());
+            }
+
+            //Provide strong guarantee on resize
+            const size_type new_capacity = _calculate_growth(capacity() + 1);
+
+            const pointer new_first    = _alloc_traits::allocate(_alloc(), new_capacity);
+            const pointer construct_at = new_first + (naked_at - _data().first);
+                  pointer new_last     = new_first;
+
+            //Note: Here the element is emplaced first, such that arguments referring to elements of this array remain valid.
+            try {
+                _alloc_traits::construct(_alloc(), construct_at, std::forward<Args>(args)...);
+            }
+            catch (...) {
+                _alloc_traits::deallocate(_alloc(), new_first, new_capacity);
+                throw;
+            }
+
+            try {
+                new_last = _transfer(_alloc(), _data().first, naked_at, new_first);
+                new_last = _transfer(_alloc(), naked_at, _data().last, construct_at + 1);
+            }
+            catch (...) {
+                //Note: new_last points at the end of the partially transferred prefix, if the suffix failed.
+                if (new_last != new_first)
+                    destroy_range(_alloc(), new_first, construct_at);
+
+                _alloc_traits::destroy(_alloc(), construct_at);
+                _alloc_traits::deallocate(_alloc(), new_first, new_capacity);
+                throw;
+            }
+
+            _destroy_transferred();
+            _replace(new_first, new_last, new_capacity);
+
+            return iterator(construct_at, &_data());
+        }
+
+        template<class ... Args>
+        constexpr iterator emplace_back(Args&& ... args)
+        {
+            if (_data().last != _data().end) {
+                u_emplace_back(std::forward<Args>(args)...);
+                return iterator(_data().last - 1, &_data());
+            }
+            else
+                return emplace(cend(), std::forward<Args>(args)...);
+        }
+
+        constexpr void push_back(const value_type& other)
+        {
+            emplace_back(other);
+        }
+
+        constexpr void push_back(value_type&& other)
+        {
+            emplace_back(std::move(other));
+        }
+
+    public:
+        template<
+            std::input_iterator InputIt,
+            std::sentinel_for<InputIt> Sentinel>
+        constexpr void insert(const const_iterator at, InputIt first, const Sentinel last)
+        {
+            const pointer naked_at = at._unwrapped();
+
+            EXPU_VERIFY_DEBUG((_data().first <= naked_at) && (naked_at <= _data().last),
+                "Insertion at pointer does not lie within constructed range (or one after the end) of the array!");
+
+            const auto at_index  = static_cast<size_type>(naked_at - _data().first);
+            const auto prev_size = size();
+
+            if constexpr (std::forward_iterator<InputIt>) {
+                const auto range_size = static_cast<size_type>(std::ranges::distance(first, last));
+
+                if (range_size == 0)
+                    return;
+
+                //Need to reallocate, copy range first then transfer elements around it.
+                if (static_cast<size_type>(_data().end - _data().last) < range_size) {
+                    const size_type new_capacity = _calculate_growth(prev_size + range_size);
+
+                    const pointer new_first = _alloc_traits::allocate(_alloc(), new_capacity);
+                    const pointer new_at    = new_first + at_index;
+                          pointer new_last  = nullptr;
+
+                    try {
+                        new_last = uninitialised_copy(_alloc(), first, last, new_at);
+                    }
+                    catch (...) {
+                        _alloc_traits::deallocate(_alloc(), new_first, new_capacity);
+                        throw;
+                    }
+
+                    pointer prefix_last = new_first;
+                    try {
+                        prefix_last = _transfer(_alloc(), _data().first, naked_at, new_first);
+                        new_last    = _transfer(_alloc(), naked_at, _data().last, new_last);
+                    }
+                    catch (...) {
+                        destroy_range(_alloc(), new_first, prefix_last);
+                        destroy_range(_alloc(), new_at, new_at + range_size);
+                        _alloc_traits::deallocate(_alloc(), new_first, new_capacity);
+                        throw;
+                    }
+
+                    _destroy_transferred();
+                    _replace(new_first, new_last, new_capacity);
+                    return;
+                }
+
+                //Shift tail into place with a single memmove, then construct range in the gap.
+                if constexpr (is_trivially_relocatable_v<value_type>) {
+                    _visit_alloc([&](auto& alloc) {
+                        const pointer new_last = uninitialised_relocate(alloc, naked_at, _data().last, naked_at + range_size);
+
+                        try {
+                            uninitialised_copy(alloc, first, last, naked_at);
+                        }
+                        catch (...) {
+                            //Provide strong guarantee
+                            uninitialised_relocate(alloc, naked_at + range_size, new_last, naked_at);
+                            throw;
+                        }
+
+                        _data().last = new_last;
+                    });
+
+                    return;
+                }
+                else
+                    _visit_alloc([&](auto& alloc) { _data().last = uninitialised_copy(alloc, first, last, _data().last); });
+            }
+            else {
+                for (; first != last; ++first)
+                    emplace_back(*first);
+            }
+
+            //If insertion does not occur at end, rotate appended elements into position.
+            if (at_index != prev_size)
+                std::rotate(_data().first + at_index, _data().first + prev_size, _data().last);
+        }
+
+    public:
+        constexpr void reserve(const size_type size)
+        {
+            if (capacity() < size)
+                _reallocate_exactly(size);
+        }
+
+        //Moves elements back inline if they fit, otherwise shrinks heap memory to fit exactly.
+        constexpr void shrink_to_fit()
+        {
+            if (_is_inline() || _data().last == _data().end)
+                return;
+
+            if (size() <= N) {
+                _inline_alloc_t inline_alloc;
+
+                const pointer new_first = _inline_first();
+                const pointer new_last  = _transfer(inline_alloc, _data().first, _data().last, new_first);
+
+                _destroy_transferred();
+                _replace(new_first, new_last, N);
+            }
+            else
+                _reallocate_exactly(size());
+        }
+
+    //Indexing functions
+    public:
+        [[nodiscard]] constexpr const_reference operator[](const size_type index) const noexcept
+        {
+            EXPU_VERIFY_DEBUG(index < size(), "Index out of range!");
+            return *(_data().first + index);
+        }
+
+        [[nodiscard]] constexpr reference operator[](const size_type index) noexcept
+        {
+            return const_cast<reference>(static_cast<const small_darray&>(*this).operator[](index));
+        }
+
+        [[nodiscard]] constexpr const_reference unchecked_front() const noexcept
+        {
+            EXPU_VERIFY_DEBUG(!empty(), "expu::small_darray is empty, no viable first value available.");
+            return *_data().first;
+        }
+
+        [[nodiscard]] constexpr reference unchecked_front() noexcept
+        {
+            return const_cast<reference>(static_cast<const small_darray&>(*this).unchecked_front());
+        }
+
+        [[nodiscard]] constexpr const_reference unchecked_back() const noexcept
+        {
+            EXPU_VERIFY_DEBUG(!empty(), "expu::small_darray is empty, no viable last value available.");
+            return *std::prev(_data().last);
+        }
+
+        [[nodiscard]] constexpr reference unchecked_back() noexcept
+        {
+            return const_cast<reference>(static_cast<const small_darray&>(*this).unchecked_back());
+        }
+
+        [[nodiscard]] constexpr const_reference front() const
+        {
+            if (!empty())
+                return unchecked_front();
+            else
+                throw std::out_of_range("expu::small_darray is empty, no viable first value available.");
+        }
+
+        [[nodiscard]] constexpr reference front()
+        {
+            return const_cast<reference>(static_cast<const small_darray&>(*this).front());
+        }
+
+        [[nodiscard]] constexpr const_reference back() const
+        {
+            if (!empty())
+                return unchecked_back();
+            else
+                throw std::out_of_range("expu::small_darray is empty, no viable last value available.");
+        }
+
+        [[nodiscard]] constexpr reference back()
+        {
+            return const_cast<reference>(static_cast<const small_darray&>(*this).back());
+        }
+
+    //Size getters
+    public:
+        [[nodiscard]] constexpr size_type size() const noexcept
+        {
+            return static_cast<size_type>(_data().last - _data().first);
+        }
+
+        [[nodiscard]] constexpr size_type capacity() const noexcept
+        {
+            return static_cast<size_type>(_data().end - _data().first);
+        }
+
+        [[nodiscard]] constexpr size_type max_size() const noexcept
+        {
+            return _alloc_traits::max_size(_alloc());
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return _data().last == _data().first;
+        }
+
+        //True if elements are stored inside the object, rather than on the heap.
+        [[nodiscard]] constexpr bool is_inline() const noexcept
+        {
+            return _is_inline();
+        }
+
+    //Range getters
+    public:
+        [[nodiscard]] constexpr iterator begin()              noexcept { return iterator(_data().first, &_data()); }
+        [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return const_iterator(_data().first, &_data()); }
+        [[nodiscard]] constexpr const_iterator begin()  const noexcept { return cbegin(); }
+
+        [[nodiscard]] constexpr iterator end()              noexcept { return iterator(_data().last, &_data()); }
+        [[nodiscard]] constexpr const_iterator cend() const noexcept { return const_iterator(_data().last, &_data()); }
+        [[nodiscard]] constexpr const_iterator end()  const noexcept { return cend(); }
+
+    public:
+        [[nodiscard]] constexpr allocator_type get_allocator() const noexcept { return _alloc(); }
+
+    //Private compressed pair access getters
+    private:
+        [[nodiscard]] constexpr       _data_t& _data()       noexcept { return _cpair.second(); }
+        [[nodiscard]] constexpr const _data_t& _data() const noexcept { return _cpair.second(); }
+
+        [[nodiscard]] constexpr       allocator_type& _alloc()       noexcept { return _cpair.first(); }
+        [[nodiscard]] constexpr const allocator_type& _alloc() const noexcept { return _cpair.first(); }
+
+    private:
+        compressed_pair<allocator_type, _data_t> _cpair;
+        _inline_storage _storage;
+    };
+
+}
+
+#endif // !EXPU_CONTAINERS_SMALL_DARRAY_HPP_INCLUDED
@@ -0,0 +1,380 @@
+#ifndef EXPU_SPLIT_LINEAR_MAP_HPP_INCLUDED
+#define EXPU_SPLIT_LINEAR_MAP_HPP_INCLUDED
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "expu/containers/darray.hpp"
+#include "expu/containers/linear_map.hpp"
+
+namespace expu {
+
+    //Iterator over the parallel key and mapped arrays of a split_linear_map, dereferencing to a pair of references.
+    //Note: Models std::random_access_iterator, though (as with any proxy reference) only an input iterator
+    //under the legacy iterator requirements.
+    template<class Key, class Mapped>
+    class _split_map_iterator
+    {
+    public:
+        using iterator_concept  = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = std::pair<Key, std::remove_const_t<Mapped>>;
+        using reference         = std::pair<const Key&, Mapped&>;
+        using difference_type   = ptrdiff_t;
+
+        struct pointer {
+            reference ref;
+
+            [[nodiscard]] constexpr const reference* operator->() const noexcept { return std::addressof(ref); }
+        };
+
+    public:
+        constexpr _split_map_iterator() noexcept = default;
+
+        constexpr _split_map_iterator(const Key* const key, Mapped* const mapped) noexcept:
+            _key(key), _mapped(mapped) {}
+
+        template<class OtherMapped>
+        requires(std::is_same_v<const OtherMapped, Mapped> && !std::is_same_v<OtherMapped, Mapped>)
+        constexpr _split_map_iterator(const _split_map_iterator<Key, OtherMapped>& other) noexcept:
+            _key(other._key), _mapped(other._mapped) {}
+
+    public:
+        [[nodiscard]] constexpr reference operator*()  const noexcept { return reference(*_key, *_mapped); }
+        [[nodiscard]] constexpr pointer   operator->() const noexcept { return pointer{ **this }; }
+
+        [[nodiscard]] constexpr reference operator[](const difference_type n) const noexcept { return *(*this + n); }
+
+    public:
+        constexpr _split_map_iterator& operator++() noexcept { ++_key; ++_mapped; return *this; }
+        constexpr _split_map_iterator& operator--() noexcept { --_key; --_mapped; return *this; }
+
+        [[nodiscard("Prefer pre-increment operator.")]]
+        constexpr _split_map_iterator operator++(int) noexcept
+        {
+            const _split_map_iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        [[nodiscard("Prefer pre-decrement operator.")]]
+        constexpr _split_map_iterator operator--(int) noexcept
+        {
+            const _split_map_iterator copy = *this;
+            --*this;
+            return copy;
+        }
+
+        constexpr _split_map_iterator& operator+=(const difference_type n) noexcept { _key += n; _mapped += n; return *this; }
+        constexpr _split_map_iterator& operator-=(const difference_type n) noexcept { _key -= n; _mapped -= n; return *this; }
+
+    public:
+        [[nodiscard]] friend constexpr _split_map_iterator operator+(_split_map_iterator it, const difference_type n) noexcept { return it += n; }
+        [[nodiscard]] friend constexpr _split_map_iterator operator+(const difference_type n, _split_map_iterator it) noexcept { return it += n; }
+        [[nodiscard]] friend constexpr _split_map_iterator operator-(_split_map_iterator it, const difference_type n) noexcept { return it -= n; }
+
+        [[nodiscard]] friend constexpr difference_type operator-(const _split_map_iterator& lhs, const _split_map_iterator& rhs) noexcept
+        {
+            return lhs._key - rhs._key;
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(const _split_map_iterator& lhs, const _split_map_iterator& rhs) noexcept
+        {
+            return lhs._key == rhs._key;
+        }
+
+        [[nodiscard]] friend constexpr std::strong_ordering operator<=>(const _split_map_iterator& lhs, const _split_map_iterator& rhs) noexcept
+        {
+            return lhs._key <=> rhs._key;
+        }
+
+    private:
+        template<class, class>
+        friend class _split_map_iterator;
+
+        const Key* _key = nullptr;
+        Mapped* _mapped = nullptr;
+    };
+
+
+    //Keys and mapped values of a map in two parallel darrays, with the members common to maps storing them so
+    //(split_linear_map and flat_map), which differ only in the order of their keys.
+    //Note: Derived is the map itself, such that only maps of the same kind compare equal or are swapped.
+    template<class Derived, class KeyType, class MappedType, class Alloc>
+    class _split_map_storage
+    {
+    protected:
+        using _key_alloc    = typename std::allocator_traits<Alloc>::template rebind_alloc<KeyType>;
+        using _mapped_alloc = typename std::allocator_traits<Alloc>::template rebind_alloc<MappedType>;
+
+        using _key_array    = darray<KeyType, _key_alloc>;
+        using _mapped_array = darray<MappedType, _mapped_alloc>;
+
+    private:
+        static constexpr bool _nothrow_swap = std::is_nothrow_swappable_v<_key_array> && std::is_nothrow_swappable_v<_mapped_array>;
+
+        using _size_type       = size_t;
+        using _difference_type = ptrdiff_t;
+        using _iterator        = _split_map_iterator<KeyType, MappedType>;
+        using _const_iterator  = _split_map_iterator<KeyType, const MappedType>;
+
+    protected:
+        constexpr _split_map_storage() = default;
+
+        constexpr explicit _split_map_storage(const Alloc& alloc):
+            _keys(_key_alloc(alloc)), _values(_mapped_alloc(alloc)) {}
+
+        //Constructs an element at index from key and the mapped value's args, returning an iterator to it.
+        //Note: Provides the strong guarantee, the key being erased if constructing the mapped value throws
+        template<class ... Args>
+        constexpr _iterator _emplace_at(const _size_type index, const KeyType& key, Args&& ... args)
+        {
+            const auto at = static_cast<_difference_type>(index);
+            _keys.emplace(_keys.begin() + at, key);
+
+            try {
+                _values.emplace(_values.begin() + at, std::forward<Args>(args)...);
+            }
+            catch (...) {
+                _keys.erase(_keys.begin() + at);
+                throw;
+            }
+
+            return begin() + at;
+        }
+
+        constexpr void _erase_at(const _size_type index)
+        {
+            const auto at = static_cast<_difference_type>(index);
+
+            _keys.erase(_keys.begin() + at);
+            _values.erase(_values.begin() + at);
+        }
+
+    public:
+        constexpr void reserve(const _size_type capacity)
+        {
+            _keys.reserve(capacity);
+            _values.reserve(capacity);
+        }
+
+    public: //Comparison operators
+        [[nodiscard]] friend constexpr bool operator==(const Derived& lhs, const Derived& rhs)
+        {
+            return std::ranges::equal(lhs.keys(), rhs.keys()) && std::ranges::equal(lhs.values(), rhs.values());
+        }
+
+    public:
+        //Note: Darrays whose allocators neither propagate nor compare equal swap their elements one by one, which
+        //may throw. Keys are then swapped back, so that they stay paired with their mapped values.
+        constexpr void swap(Derived& other) noexcept(_nothrow_swap)
+        {
+            _split_map_storage& storage = other;
+
+            std::swap(_keys, storage._keys);
+
+            if constexpr (_nothrow_swap)
+                std::swap(_values, storage._values);
+            else {
+                try {
+                    std::swap(_values, storage._values);
+                }
+                catch (...) {
+                    std::swap(_keys, storage._keys);
+                    throw;
+                }
+            }
+        }
+
+        friend constexpr void swap(Derived& lhs, Derived& rhs)
+            noexcept(noexcept(lhs.swap(rhs)))
+        {
+            lhs.swap(rhs);
+        }
+
+    public: //Size getters
+        [[nodiscard]] constexpr _size_type size()  const noexcept { return static_cast<_size_type>(_keys.size()); }
+        [[nodiscard]] constexpr bool       empty() const noexcept { return _keys.empty(); }
+
+    public: //Array getters
+        [[nodiscard]] constexpr std::span<const KeyType>    keys()   const noexcept { return { _key_data(), size() }; }
+        [[nodiscard]] constexpr std::span<MappedType>       values()       noexcept { return { _value_data(), size() }; }
+        [[nodiscard]] constexpr std::span<const MappedType> values() const noexcept { return { _value_data(), size() }; }
+
+    public: //Iterator getters
+        [[nodiscard]] constexpr _iterator begin() noexcept { return _iterator(_key_data(), _value_data()); }
+        [[nodiscard]] constexpr _iterator end()   noexcept { return begin() + static_cast<_difference_type>(size()); }
+
+        [[nodiscard]] constexpr _const_iterator begin()  const noexcept { return _const_iterator(_key_data(), _value_data()); }
+        [[nodiscard]] constexpr _const_iterator end()    const noexcept { return begin() + static_cast<_difference_type>(size()); }
+        [[nodiscard]] constexpr _const_iterator cbegin() const noexcept { return begin(); }
+        [[nodiscard]] constexpr _const_iterator cend()   const noexcept { return end(); }
+
+    protected:
+        //Note: Empty darrays' iterators may not be dereferenced, even through std::to_address
+        [[nodiscard]] constexpr const KeyType*    _key_data()   const noexcept { return empty() ? nullptr : std::to_address(_keys.begin()); }
+        [[nodiscard]] constexpr MappedType*       _value_data()       noexcept { return empty() ? nullptr : std::to_address(_values.begin()); }
+        [[nodiscard]] constexpr const MappedType* _value_data() const noexcept { return empty() ? nullptr : std::to_address(_values.begin()); }
+
+    protected:
+        _key_array    _keys;
+        _mapped_array _values;
+    };
+
+
+    //Unordered map with the interface of linear_map, storing keys and mapped values in two parallel darrays.
+    //Lookups scan the key array alone (see expu::_find_key for arithmetic and pointer keys), touching the mapped
+    //array only at the index found, hence large mapped values are never dragged through the cache by a lookup.
+    template<
+        class KeyType,
+        class MappedType,
+        class Alloc    = std::allocator<KeyType>,
+        class KeyEqual = std::equal_to<KeyType>>
+    class split_linear_map : public _split_map_storage<split_linear_map<KeyType, MappedType, Alloc, KeyEqual>, KeyType, MappedType, Alloc>
+    {
+    private:
+        using _storage = _split_map_storage<split_linear_map, KeyType, MappedType, Alloc>;
+
+    public: //Typedefs
+        using key_type        = KeyType;
+        using mapped_type     = MappedType;
+        using key_equal       = KeyEqual;
+        using allocator_type  = Alloc;
+        using value_type      = std::pair<KeyType, MappedType>;
+        using reference       = std::pair<const KeyType&, MappedType&>;
+        using const_reference = std::pair<const KeyType&, const MappedType&>;
+        using size_type       = size_t;
+        using difference_type = ptrdiff_t;
+        using iterator        = _split_map_iterator<KeyType, MappedType>;
+        using const_iterator  = _split_map_iterator<KeyType, const MappedType>;
+
+    private:
+        //Note: Lookups default construct key_equal, then call it on every key they scan. std::equal_to's call operator
+        //is not marked noexcept, hence the keys' own operator== is checked instead.
+        static constexpr bool _nothrow_equal =
+            std::is_nothrow_default_constructible_v<key_equal> &&
+            ((std::is_same_v<key_equal, std::equal_to<key_type>> || std::is_same_v<key_equal, std::equal_to<>>) ?
+                noexcept(std::declval<const key_type&>() == std::declval<const key_type&>()) :
+                std::is_nothrow_invocable_v<key_equal, const key_type&, const key_type&>);
+
+        //Note: Keys compared through KeyEqual other than std::equal_to cannot be compared by their bytes
+        static constexpr bool _scannable =
+            _scannable_key<key_type> &&
+            (std::is_same_v<key_equal, std::equal_to<key_type>> || std::is_same_v<key_equal, std::equal_to<>>);
+
+        using _storage::_keys;
+        using _storage::_values;
+        using _storage::_key_data;
+
+    public: //Constructors
+        constexpr split_linear_map() = default;
+
+        constexpr explicit split_linear_map(const Alloc& alloc):
+            _storage(alloc) {}
+
+        //Note: Later duplicates of a key are ignored
+        constexpr split_linear_map(const std::initializer_list<value_type> elements, const Alloc& alloc = Alloc()):
+            split_linear_map(alloc)
+        {
+            this->reserve(elements.size());
+
+            for (const value_type& element : elements)
+                try_emplace(element.first, element.second);
+        }
+
+    public:
+        //Note: Members of a dependent base are not found by unqualified lookup
+        using _storage::size;
+        using _storage::empty;
+        using _storage::begin;
+        using _storage::end;
+
+        //Index of the element with the given key, or size() if there is none.
+        [[nodiscard]] constexpr size_type index_of(const key_type& key) const noexcept(_nothrow_equal)
+        {
+            if constexpr (_scannable) {
+                if (!std::is_constant_evaluated() && !empty())
+                    return _find_key(_key_data(), size(), key);
+            }
+
+            return static_cast<size_type>(std::ranges::find_if(_keys, [&](const key_type& other) { return key_equal{}(other, key); }) - _keys.begin());
+        }
+
+        [[nodiscard]] constexpr const_iterator find(const key_type& key) const noexcept(_nothrow_equal)
+        {
+            return begin() + static_cast<difference_type>(index_of(key));
+        }
+
+        [[nodiscard]] constexpr iterator find(const key_type& key) noexcept(_nothrow_equal)
+        {
+            return begin() + static_cast<difference_type>(index_of(key));
+        }
+
+        [[nodiscard]] constexpr bool contains(const key_type& key) const noexcept(_nothrow_equal)
+        {
+            return index_of(key) != size();
+        }
+
+    public: // Indexing functions
+        [[nodiscard]] constexpr const mapped_type& at(const key_type& key) const
+        {
+            const size_type index = index_of(key);
+
+            if (index == size())
+                throw std::out_of_range("Key not found!");
+            else
+                return _values[index];
+        }
+
+        [[nodiscard]] constexpr mapped_type& at(const key_type& key)
+        {
+            return const_cast<mapped_type&>(static_cast<const split_linear_map&>(*this).at(key));
+        }
+
+        [[nodiscard]] constexpr const mapped_type& operator[](const key_type& key) const
+        {
+            const size_type index = index_of(key);
+            EXPU_VERIFY_DEBUG(index != size(), "Key not found!");
+
+            return _values[index];
+        }
+
+        constexpr mapped_type& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+
+    public: //Insertion functions
+        //Constructs the mapped value from args if the key is not present, returning the element and whether it was inserted.
+        template<class ... Args>
+        constexpr std::pair<iterator, bool> try_emplace(const key_type& key, Args&& ... args)
+        {
+            const size_type index = index_of(key);
+
+            if (index != size())
+                return { begin() + static_cast<difference_type>(index), false };
+
+            return { this->_emplace_at(index, key, std::forward<Args>(args)...), true };
+        }
+
+    public: //Erasion functions
+        constexpr void erase(const key_type& key)
+        {
+            const size_type index = index_of(key);
+
+            if (index != size())
+                this->_erase_at(index);
+        }
+    };
+}
+
+#endif // !EXPU_SPLIT_LINEAR_MAP_HPP_INCLUDED
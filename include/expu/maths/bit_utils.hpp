@@ -0,0 +1,451 @@
+#ifndef EXPU_BIT_UTILS_HPP_INCLUDED
+#define EXPU_BIT_UTILS_HPP_INCLUDED
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__AVX512F__) || defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#include "expu/maths/basic_maths.hpp"
+
+namespace expu {
+
+    //Packed bits (e.g. fixed_array<bool>) are stored in words, such that bulk operations process a word per step.
+    //Bit i of a range lies in word i / _bit_word_bits, at position i % _bit_word_bits (least significant first).
+    //Note: Bits past the end of a range, in its last word, are always kept zero.
+    using _bit_word = uint64_t;
+
+    inline constexpr size_t _bit_word_bits  = std::numeric_limits<_bit_word>::digits;
+    inline constexpr unsigned char _bit_word_shift = 6;
+
+    static_assert(size_t(1) << _bit_word_shift == _bit_word_bits);
+
+    inline constexpr _bit_word _all_bits_set = ~_bit_word(0);
+
+    //Number of words required to store bit_count bits.
+    [[nodiscard]] constexpr size_t _bit_word_count(const size_t bit_count) noexcept
+    {
+        return right_shift_round_up(bit_count, _bit_word_shift);
+    }
+
+    //Mask of the bits in use in the last word of a range of bit_count bits.
+    [[nodiscard]] constexpr _bit_word _bit_tail_mask(const size_t bit_count) noexcept
+    {
+        const size_t remainder = bit_count & (_bit_word_bits - 1);
+        return remainder ? (_bit_word(1) << remainder) - 1 : _all_bits_set;
+    }
+
+    //Sets the first bit_count bits of words to value, whole words at a time.
+    constexpr void _fill_bits(_bit_word* const words, const size_t bit_count, const bool value) noexcept
+    {
+        if (!bit_count)
+            return;
+
+        const size_t word_count = _bit_word_count(bit_count);
+
+        std::fill_n(words, word_count, value ? _all_bits_set : 0);
+        words[word_count - 1] &= _bit_tail_mask(bit_count);
+    }
+
+
+    //Sets the bit range [first_bit, last_bit) of words.
+    constexpr void _set_bit_range(_bit_word* const words, const size_t first_bit, const size_t last_bit) noexcept
+    {
+        if (last_bit <= first_bit)
+            return;
+
+        const size_t first_word = first_bit >> _bit_word_shift;
+        const size_t last_word  = (last_bit - 1) >> _bit_word_shift;
+
+        const _bit_word head_mask = _all_bits_set << (first_bit & (_bit_word_bits - 1));
+        const _bit_word tail_mask = _bit_tail_mask(last_bit);
+
+        if (first_word == last_word) {
+            words[first_word] |= head_mask & tail_mask;
+            return;
+        }
+
+        words[first_word] |= head_mask;
+        std::fill(words + first_word + 1, words + last_word, _all_bits_set);
+        words[last_word] |= tail_mask;
+    }
+
+    //////////////////////////////////////BITWISE OPERATIONS///////////////////////////////////////////////////////////////////////////////
+
+    //Note: SIMD paths are selected at compile time (e.g. -mavx2 or -march=native), falling back to plain word
+    //operations and std::popcount, which compiles to a popcnt instruction where available.
+
+    //Binary word operations, applicable to scalar words and SIMD vectors of words alike.
+    //Note: Overloaded per width rather than templated, as vector types lose their attributes as template arguments
+    struct _bit_and
+    {
+        [[nodiscard]] constexpr _bit_word operator()(const _bit_word lhs, const _bit_word rhs) const noexcept { return lhs & rhs; }
+#if defined(__AVX2__)
+        [[nodiscard]] __m256i operator()(const __m256i lhs, const __m256i rhs) const noexcept { return _mm256_and_si256(lhs, rhs); }
+#endif
+#if defined(__AVX512F__)
+        [[nodiscard]] __m512i operator()(const __m512i lhs, const __m512i rhs) const noexcept { return _mm512_and_si512(lhs, rhs); }
+#endif
+    };
+
+    struct _bit_or
+    {
+        [[nodiscard]] constexpr _bit_word operator()(const _bit_word lhs, const _bit_word rhs) const noexcept { return lhs | rhs; }
+#if defined(__AVX2__)
+        [[nodiscard]] __m256i operator()(const __m256i lhs, const __m256i rhs) const noexcept { return _mm256_or_si256(lhs, rhs); }
+#endif
+#if defined(__AVX512F__)
+        [[nodiscard]] __m512i operator()(const __m512i lhs, const __m512i rhs) const noexcept { return _mm512_or_si512(lhs, rhs); }
+#endif
+    };
+
+    struct _bit_xor
+    {
+        [[nodiscard]] constexpr _bit_word operator()(const _bit_word lhs, const _bit_word rhs) const noexcept { return lhs ^ rhs; }
+#if defined(__AVX2__)
+        [[nodiscard]] __m256i operator()(const __m256i lhs, const __m256i rhs) const noexcept { return _mm256_xor_si256(lhs, rhs); }
+#endif
+#if defined(__AVX512F__)
+        [[nodiscard]] __m512i operator()(const __m512i lhs, const __m512i rhs) const noexcept { return _mm512_xor_si512(lhs, rhs); }
+#endif
+    };
+
+    //lhs & ~rhs
+    struct _bit_and_not
+    {
+        [[nodiscard]] constexpr _bit_word operator()(const _bit_word lhs, const _bit_word rhs) const noexcept { return lhs & ~rhs; }
+#if defined(__AVX2__)
+        [[nodiscard]] __m256i operator()(const __m256i lhs, const __m256i rhs) const noexcept { return _mm256_andnot_si256(rhs, lhs); }
+#endif
+#if defined(__AVX512F__)
+        [[nodiscard]] __m512i operator()(const __m512i lhs, const __m512i rhs) const noexcept { return _mm512_andnot_si512(rhs, lhs); }
+#endif
+    };
+
+    //Returns lhs, such that a single range may be passed through the binary kernels.
+    struct _bit_first
+    {
+        [[nodiscard]] constexpr _bit_word operator()(const _bit_word lhs, const _bit_word) const noexcept { return lhs; }
+#if defined(__AVX2__)
+        [[nodiscard]] __m256i operator()(const __m256i lhs, const __m256i) const noexcept { return lhs; }
+#endif
+#if defined(__AVX512F__)
+        [[nodiscard]] __m512i operator()(const __m512i lhs, const __m512i) const noexcept { return lhs; }
+#endif
+    };
+
+    //dest[i] = op(lhs[i], rhs[i]) for each of the word_count words. dest may alias lhs or rhs.
+    template<class Op>
+    constexpr void _transform_words(_bit_word* const dest, const _bit_word* const lhs, const _bit_word* const rhs, const size_t word_count, const Op op) noexcept
+    {
+        size_t index = 0;
+
+#if defined(__AVX2__)
+        if (!std::is_constant_evaluated()) {
+            for (; index + 4 <= word_count; index += 4) {
+                const __m256i lhs_words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + index));
+                const __m256i rhs_words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + index));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + index), op(lhs_words, rhs_words));
+            }
+        }
+#endif
+        for (; index < word_count; ++index)
+            dest[index] = op(lhs[index], rhs[index]);
+    }
+
+#if defined(__AVX2__)
+    //Number of bits set in each 64-bit lane, through a per-nibble lookup (see Mula et al., "Faster Population Counts")
+    [[nodiscard]] inline __m256i _popcount_lanes(const __m256i words) noexcept
+    {
+        const __m256i lookup = _mm256_setr_epi8(
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i low_mask = _mm256_set1_epi8(0x0F);
+
+        const __m256i low  = _mm256_shuffle_epi8(lookup, _mm256_and_si256(words, low_mask));
+        const __m256i high = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(words, 4), low_mask));
+
+        return _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256());
+    }
+#endif
+
+    //Number of bits set in op(lhs[i], rhs[i]) over the word_count words, without storing the intermediate words.
+    template<class Op>
+    [[nodiscard]] constexpr size_t _count_transformed_words(const _bit_word* const lhs, const _bit_word* const rhs, const size_t word_count, const Op op) noexcept
+    {
+        size_t result = 0;
+        size_t index  = 0;
+
+        if (!std::is_constant_evaluated()) {
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+            __m512i total = _mm512_setzero_si512();
+            for (; index + 8 <= word_count; index += 8) {
+                const __m512i words = op(_mm512_loadu_si512(lhs + index), _mm512_loadu_si512(rhs + index));
+                total = _mm512_add_epi64(total, _mm512_popcnt_epi64(words));
+            }
+
+            result = static_cast<size_t>(_mm512_reduce_add_epi64(total));
+#elif defined(__AVX2__)
+            __m256i total = _mm256_setzero_si256();
+            for (; index + 4 <= word_count; index += 4) {
+                const __m256i words = op(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + index)),
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + index)));
+
+                total = _mm256_add_epi64(total, _popcount_lanes(words));
+            }
+
+            result = static_cast<size_t>(
+                _mm256_extract_epi64(total, 0) + _mm256_extract_epi64(total, 1) +
+                _mm256_extract_epi64(total, 2) + _mm256_extract_epi64(total, 3));
+#endif
+        }
+
+        for (; index < word_count; ++index)
+            result += static_cast<size_t>(std::popcount(op(lhs[index], rhs[index])));
+
+        return result;
+    }
+
+    //Shifts the bit range [0, bit_count) of words towards higher indices, shifting in zeros.
+    constexpr void _shift_bits_up(_bit_word* const words, const size_t bit_count, const size_t shift) noexcept
+    {
+        const size_t word_count = _bit_word_count(bit_count);
+        const size_t word_shift = shift >> _bit_word_shift;
+        const size_t bit_shift  = shift & (_bit_word_bits - 1);
+
+        if (word_count <= word_shift) {
+            std::fill_n(words, word_count, 0);
+            return;
+        }
+
+        for (size_t index = word_count - 1; index != word_shift; --index) {
+            const _bit_word low = bit_shift ? words[index - word_shift - 1] >> (_bit_word_bits - bit_shift) : 0;
+            words[index] = (words[index - word_shift] << bit_shift) | low;
+        }
+
+        words[word_shift] = words[0] << bit_shift;
+        std::fill_n(words, word_shift, 0);
+
+        words[word_count - 1] &= _bit_tail_mask(bit_count);
+    }
+
+    //Shifts the bit range [0, bit_count) of words towards lower indices, shifting in zeros.
+    //Note: Relies on bits past bit_count being zero
+    constexpr void _shift_bits_down(_bit_word* const words, const size_t bit_count, const size_t shift) noexcept
+    {
+        const size_t word_count = _bit_word_count(bit_count);
+        const size_t word_shift = shift >> _bit_word_shift;
+        const size_t bit_shift  = shift & (_bit_word_bits - 1);
+
+        if (word_count <= word_shift) {
+            std::fill_n(words, word_count, 0);
+            return;
+        }
+
+        const size_t last_index = word_count - word_shift - 1;
+
+        for (size_t index = 0; index != last_index; ++index) {
+            const _bit_word high = bit_shift ? words[index + word_shift + 1] << (_bit_word_bits - bit_shift) : 0;
+            words[index] = (words[index + word_shift] >> bit_shift) | high;
+        }
+
+        words[last_index] = words[word_count - 1] >> bit_shift;
+        std::fill_n(words + last_index + 1, word_shift, 0);
+    }
+
+
+    //////////////////////////////////////BIT COUNTING AND SEARCHING///////////////////////////////////////////////////////////////////////////////
+
+    //Number of bits set in words [words, words + word_count).
+    [[nodiscard]] constexpr size_t _count_words(const _bit_word* const words, const size_t word_count) noexcept
+    {
+        return _count_transformed_words(words, words, word_count, _bit_first{});
+    }
+
+    //Number of bits set in the bit range [first_bit, last_bit) of words.
+    [[nodiscard]] constexpr size_t _count_bits(const _bit_word* const words, const size_t first_bit, const size_t last_bit) noexcept
+    {
+        if (last_bit <= first_bit)
+            return 0;
+
+        const size_t first_word = first_bit >> _bit_word_shift;
+        const size_t last_word  = (last_bit - 1) >> _bit_word_shift;
+
+        const _bit_word head_mask = _all_bits_set << (first_bit & (_bit_word_bits - 1));
+        const _bit_word tail_mask = _bit_tail_mask(last_bit);
+
+        if (first_word == last_word)
+            return static_cast<size_t>(std::popcount(words[first_word] & head_mask & tail_mask));
+
+        return
+            static_cast<size_t>(std::popcount(words[first_word] & head_mask)) +
+            _count_words(words + first_word + 1, last_word - first_word - 1) +
+            static_cast<size_t>(std::popcount(words[last_word] & tail_mask));
+    }
+
+    //Position of the k-th (from 0) bit set in word, k must be less than the number of bits set.
+    [[nodiscard]] constexpr size_t _select_in_word(_bit_word word, size_t k) noexcept
+    {
+#if defined(__BMI2__)
+        //Note: Deposits a single bit at the position of the k-th set bit of word
+        if (!std::is_constant_evaluated())
+            return static_cast<size_t>(std::countr_zero(_pdep_u64(_bit_word(1) << k, word)));
+#endif
+        for (; k; --k)
+            word &= word - 1;
+
+        return static_cast<size_t>(std::countr_zero(word));
+    }
+
+    //Index of the first word in [first_word, last_word) which isn't equal to skipped, or last_word if none.
+    [[nodiscard]] constexpr size_t _skip_words(const _bit_word* const words, size_t first_word, const size_t last_word, const _bit_word skipped) noexcept
+    {
+#if defined(__AVX2__)
+        if (!std::is_constant_evaluated()) {
+            const __m256i skipped_words = _mm256_set1_epi64x(static_cast<long long>(skipped));
+
+            for (; first_word + 4 <= last_word; first_word += 4) {
+                const __m256i value = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + first_word)), skipped_words);
+                if (!_mm256_testz_si256(value, value))
+                    break;
+            }
+        }
+#endif
+        for (; first_word != last_word; ++first_word)
+            if (words[first_word] != skipped)
+                break;
+
+        return first_word;
+    }
+
+    //Index of the first bit equal to value in the bit range [first_bit, last_bit) of words, or last_bit if none.
+    [[nodiscard]] constexpr size_t _find_bit(const _bit_word* const words, const size_t first_bit, const size_t last_bit, const bool value) noexcept
+    {
+        if (last_bit <= first_bit)
+            return last_bit;
+
+        //Note: Searching for unset bits is searching for set bits in the complement
+        const _bit_word flip = value ? 0 : _all_bits_set;
+
+        const size_t end_word = ((last_bit - 1) >> _bit_word_shift) + 1;
+        size_t word_index = first_bit >> _bit_word_shift;
+
+        _bit_word word = (words[word_index] ^ flip) & (_all_bits_set << (first_bit & (_bit_word_bits - 1)));
+
+        if (!word) {
+            word_index = _skip_words(words, word_index + 1, end_word, flip);
+            if (word_index == end_word)
+                return last_bit;
+
+            word = words[word_index] ^ flip;
+        }
+
+        //Note: Bits past last_bit may be set in the complement
+        return std::min((word_index << _bit_word_shift) + static_cast<size_t>(std::countr_zero(word)), last_bit);
+    }
+
+
+    //////////////////////////////////////BYTE PACKING///////////////////////////////////////////////////////////////////////////////
+
+    //Single byte flags, packed as set if non-zero.
+    template<class Type>
+    concept _byte_flag = std::same_as<std::remove_cv_t<Type>, bool> || (std::integral<Type> && sizeof(Type) == 1);
+
+    //Packs count flags into words, a bit per non-zero byte. Unused bits of the last word are zeroed.
+    constexpr void _pack_bytes(_bit_word* const words, const uint8_t* const bytes, const size_t count) noexcept
+    {
+        size_t word_index = 0;
+
+        if (!std::is_constant_evaluated()) {
+#if defined(__AVX512BW__)
+            for (; (word_index + 1) * _bit_word_bits <= count; ++word_index) {
+                const __m512i flags = _mm512_loadu_si512(bytes + word_index * _bit_word_bits);
+                words[word_index] = _mm512_test_epi8_mask(flags, flags);
+            }
+#elif defined(__AVX2__)
+            const __m256i zero = _mm256_setzero_si256();
+
+            for (; (word_index + 1) * _bit_word_bits <= count; ++word_index) {
+                const uint8_t* const first = bytes + word_index * _bit_word_bits;
+
+                //Note: Masks of the zero bytes, hence inverted
+                const auto low  = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)), zero)));
+                const auto high = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + 32)), zero)));
+
+                words[word_index] = ~(_bit_word(high) << 32 | low);
+            }
+#endif
+        }
+
+        for (size_t index = word_index * _bit_word_bits; index < count; index += _bit_word_bits) {
+            const size_t last = std::min(index + _bit_word_bits, count);
+
+            _bit_word word = 0;
+            for (size_t bit = index; bit != last; ++bit)
+                word |= _bit_word(bytes[bit] != 0) << (bit - index);
+
+            words[index >> _bit_word_shift] = word;
+        }
+    }
+
+    //Writes each of count bits of words, as a 0 or 1 byte, to bytes.
+    constexpr void _unpack_bytes(const _bit_word* const words, const size_t count, uint8_t* const bytes) noexcept
+    {
+        size_t index = 0;
+
+        if (!std::is_constant_evaluated()) {
+#if defined(__AVX512BW__)
+            const __m512i ones = _mm512_set1_epi8(1);
+
+            for (; index + _bit_word_bits <= count; index += _bit_word_bits)
+                _mm512_storeu_si512(bytes + index, _mm512_maskz_mov_epi8(words[index >> _bit_word_shift], ones));
+#elif defined(__AVX2__)
+            //Note: Broadcasts 32 bits, shuffling bits [8i, 8i + 8) into bytes [8i, 8i + 8), then isolating a bit per byte
+            const __m256i shuffle = _mm256_setr_epi8(
+                0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+            const __m256i bit_of_byte = _mm256_set1_epi64x(static_cast<long long>(0x8040201008040201));
+            const __m256i ones        = _mm256_set1_epi8(1);
+
+            for (; index + 32 <= count; index += 32) {
+                const auto bits = static_cast<uint32_t>(words[index >> _bit_word_shift] >> (index & (_bit_word_bits - 1)));
+
+                const __m256i spread = _mm256_and_si256(_mm256_shuffle_epi8(_mm256_set1_epi32(static_cast<int>(bits)), shuffle), bit_of_byte);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(bytes + index), _mm256_and_si256(_mm256_cmpeq_epi8(spread, bit_of_byte), ones));
+            }
+#endif
+        }
+
+        for (; index < count; ++index)
+            bytes[index] = static_cast<uint8_t>((words[index >> _bit_word_shift] >> (index & (_bit_word_bits - 1))) & 1);
+    }
+
+    //Packs pred(values[i]) for each of count values into words. Unused bits of the last word are zeroed.
+    //Note: Predicates are evaluated into a block of byte flags, a loop the compiler vectorises for simple
+    //comparisons, which is then packed through _pack_bytes.
+    template<class Type, class Pred>
+    constexpr void _pack_predicate(_bit_word* const words, const Type* const values, const size_t count, Pred& pred)
+    {
+        uint8_t flags[_bit_word_bits] = {};
+
+        for (size_t index = 0; index < count; index += _bit_word_bits) {
+            const size_t block_size = std::min(_bit_word_bits, count - index);
+
+            for (size_t offset = 0; offset != block_size; ++offset)
+                flags[offset] = static_cast<uint8_t>(static_cast<bool>(pred(values[index + offset])));
+
+            _pack_bytes(words + (index >> _bit_word_shift), flags, block_size);
+        }
+    }
+}
+
+#endif // !EXPU_BIT_UTILS_HPP_INCLUDED
@@ -0,0 +1,56 @@
+#ifndef EXPU_HASH_UTILS_HPP_INCLUDED
+#define EXPU_HASH_UTILS_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h> //For access to _umul128
+#endif
+
+namespace expu {
+
+    //High and low halves of the full 128 bit product of lhs and rhs, xored together.
+    [[nodiscard]] constexpr uint64_t _fold_multiply(const uint64_t lhs, const uint64_t rhs) noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+        const unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
+        return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#else
+#if defined(_MSC_VER) && defined(_M_X64)
+        if (!std::is_constant_evaluated()) {
+            uint64_t high;
+            const uint64_t low = _umul128(lhs, rhs, &high);
+            return low ^ high;
+        }
+#endif
+        const uint64_t lhs_low = lhs & 0xFFFFFFFF, lhs_high = lhs >> 32;
+        const uint64_t rhs_low = rhs & 0xFFFFFFFF, rhs_high = rhs >> 32;
+
+        const uint64_t low_low   = lhs_low * rhs_low;
+        const uint64_t high_low  = lhs_high * rhs_low;
+        const uint64_t low_high  = lhs_low * rhs_high;
+        const uint64_t high_high = lhs_high * rhs_high;
+
+        const uint64_t middle = (low_low >> 32) + (high_low & 0xFFFFFFFF) + low_high;
+
+        const uint64_t low  = (middle << 32) | (low_low & 0xFFFFFFFF);
+        const uint64_t high = high_high + (high_low >> 32) + (middle >> 32);
+        return low ^ high;
+#endif
+    }
+
+    //Mixes the bits of a hash, such that its low and high bits both depend on every bit of the original. Tables
+    //index by some of these bits (flat_hash_map splits them into h1 and h2, adaptive_map masks the low ones).
+    //Note: std::hash of integers is the identity with common standard libraries, which would leave those bits
+    //to the low bits of the key alone, e.g. always 0 for aligned pointers.
+    //Note: The low half of the product only depends on the low bits of the hash, hence the high half is folded
+    //into it, its every bit depending on the whole hash.
+    [[nodiscard]] constexpr size_t _mix_hash(const size_t hash) noexcept
+    {
+        return static_cast<size_t>(_fold_multiply(static_cast<uint64_t>(hash), 0x9E3779B97F4A7C15ull));
+    }
+}
+
+#endif // !EXPU_HASH_UTILS_HPP_INCLUDED
@@ -3,9 +3,18 @@
 
 #include <type_traits> //For access to is_nothrow_x, is_trivially_x, etc traits
 #include <iterator>    //For access to iterator_traits and iterator concepts
-#include <memory>      //For access to memcpy and memmove
+#include <memory>      //For access to allocator_traits and unique_ptr
+#include <cstring>     //For access to memcpy and memmove
+#include <cstdint>     //For access to uintptr_t
+
+#if defined(__AVX2__)
+#include <immintrin.h> //For access to non-temporal stores
+#elif defined(__SSE2__)
+#include <emmintrin.h> //For access to non-temporal stores
+#endif
 
 #include "expu/maths/basic_maths.hpp"
+#include "expu/maths/bit_utils.hpp"
 
 #include "expu/meta/meta_utils.hpp"
 
@@ -345,16 +354,102 @@ namespace expu {
     };
 
 
-    template<bool not_overlapping>
+    //Writes larger than this many bytes bypass the cache through non-temporal stores, as they would evict the
+    //whole last level cache regardless. Should be set to roughly the size of the target's last level cache.
+#ifndef EXPU_NON_TEMPORAL_THRESHOLD
+#define EXPU_NON_TEMPORAL_THRESHOLD (size_t(32) << 20)
+#endif
+
+    inline constexpr size_t _non_temporal_threshold = EXPU_NON_TEMPORAL_THRESHOLD;
+
+    //Tag requesting that a copy bypasses the cache through non-temporal stores regardless of its size, e.g. when
+    //taking a snapshot which will not be read again soon.
+    struct non_temporal_t { explicit non_temporal_t() = default; };
+    inline constexpr non_temporal_t non_temporal{};
+
+    //Vectors written by streaming stores (and vector fills): 32 bytes with AVX2, otherwise 16 bytes with SSE2,
+    //which every x86-64 target has. Without either, streaming copies and vector fills fall back to memcpy.
+#if defined(__AVX2__)
+    using _stream_vector_t = __m256i;
+
+    [[nodiscard]] inline __m256i _vector_loadu(const void* const src) noexcept { return _mm256_loadu_si256(static_cast<const __m256i*>(src)); }
+    inline void _vector_storeu(void* const dest, const __m256i vector) noexcept { _mm256_storeu_si256(static_cast<__m256i*>(dest), vector); }
+    inline void _vector_stream(void* const dest, const __m256i vector) noexcept { _mm256_stream_si256(static_cast<__m256i*>(dest), vector); }
+#elif defined(__SSE2__)
+    using _stream_vector_t = __m128i;
+
+    [[nodiscard]] inline __m128i _vector_loadu(const void* const src) noexcept { return _mm_loadu_si128(static_cast<const __m128i*>(src)); }
+    inline void _vector_storeu(void* const dest, const __m128i vector) noexcept { _mm_storeu_si128(static_cast<__m128i*>(dest), vector); }
+    inline void _vector_stream(void* const dest, const __m128i vector) noexcept { _mm_stream_si128(static_cast<__m128i*>(dest), vector); }
+#endif
+
+    //Copies size bytes from src to dest through non-temporal stores, which write straight to memory instead of
+    //evicting the cache. The ranges must not overlap.
+    inline void* _stream_memcpy(void* const dest, const void* const src, size_t size) noexcept
+    {
+#if defined(__AVX2__) || defined(__SSE2__)
+        constexpr size_t width = sizeof(_stream_vector_t);
+
+        char* output = static_cast<char*>(dest);
+        const char* input = static_cast<const char*>(src);
+
+        //Note: Streaming stores must be aligned, hence leading bytes are copied until output is aligned
+        const size_t head = std::min(size, (width - reinterpret_cast<uintptr_t>(output) % width) % width);
+        std::memcpy(output, input, head);
+
+        output += head;
+        input  += head;
+        size   -= head;
+
+        for (; 4 * width <= size; size -= 4 * width, output += 4 * width, input += 4 * width) {
+            const _stream_vector_t first  = _vector_loadu(input);
+            const _stream_vector_t second = _vector_loadu(input + width);
+            const _stream_vector_t third  = _vector_loadu(input + 2 * width);
+            const _stream_vector_t fourth = _vector_loadu(input + 3 * width);
+
+            _vector_stream(output,             first);
+            _vector_stream(output + width,     second);
+            _vector_stream(output + 2 * width, third);
+            _vector_stream(output + 3 * width, fourth);
+        }
+
+        for (; width <= size; size -= width, output += width, input += width)
+            _vector_stream(output, _vector_loadu(input));
+
+        //Note: Streaming stores are weakly ordered, they must be visible before any later store (e.g. publishing the copy)
+        _mm_sfence();
+
+        std::memcpy(output, input, size);
+        return dest;
+#else
+        return std::memcpy(dest, src, size);
+#endif
+    }
+
+    [[nodiscard]] inline bool _bytes_overlap(const void* const dest, const void* const src, const size_t size) noexcept
+    {
+        const auto dest_address = reinterpret_cast<uintptr_t>(dest);
+        const auto src_address  = reinterpret_cast<uintptr_t>(src);
+
+        return dest_address < src_address + size && src_address < dest_address + size;
+    }
+
+    //Copies larger than _non_temporal_threshold (or any size if streaming is set) between disjoint ranges go
+    //through streaming stores.
+    template<bool not_overlapping, bool streaming = false>
     void* _memcpy_or_memmove(void* dest, const void* src, size_t size) noexcept
     {
+        if (streaming || _non_temporal_threshold <= size)
+            if (not_overlapping || !_bytes_overlap(dest, src, size))
+                return _stream_memcpy(dest, src, size);
+
         if constexpr (not_overlapping)
             return std::memcpy(dest, src, size);
         else
             return std::memmove(dest, src, size);
     }
 
-    template<bool not_overlapping>
+    template<bool not_overlapping, bool streaming = false>
     struct _range_memcpy_or_memmove : private _not_quite_object
     {
         using _not_quite_object::_not_quite_object;
@@ -370,7 +465,7 @@ namespace expu {
             size_t count = static_cast<size_t>(last - first);
             size_t size = count * sizeof(std::iter_value_t<SrcCtgIt>);
 
-            _memcpy_or_memmove<not_overlapping>(output_chr, std::to_address(first), size);
+            _memcpy_or_memmove<not_overlapping, streaming>(output_chr, std::to_address(first), size);
             return output + count;
         }
     };     
@@ -378,6 +473,9 @@ namespace expu {
     inline constexpr _range_memcpy_or_memmove<true>  _range_memcpy {_not_quite_object::construct_tag{}};
     inline constexpr _range_memcpy_or_memmove<false> _range_memmove{_not_quite_object::construct_tag{}};
 
+    inline constexpr _range_memcpy_or_memmove<true, true>  _range_stream_memcpy {_not_quite_object::construct_tag{}};
+    inline constexpr _range_memcpy_or_memmove<false, true> _range_stream_memmove{_not_quite_object::construct_tag{}};
+
 
     template<bool not_overlapping>
     struct _range_backward_memcpy_or_memmove : private _not_quite_object
@@ -409,43 +507,205 @@ namespace expu {
     inline constexpr _range_backward_memcpy_or_memmove<false> _range_backward_memmove{_not_quite_object::construct_tag{}};  
 
 
-    template<
-        std::contiguous_iterator CtgIt,
-        std::sized_sentinel_for<CtgIt> SizedSentinel>
-    void* set_bits(void* const bits, CtgIt first, const SizedSentinel last)
+    //Fills n objects at first with the pattern of bytes (of a single object), through vector stores (see
+    //expu::_stream_vector_t). Returns false, writing nothing, if there are no vector stores, or if non_temporal
+    //is set and first cannot be aligned for streaming stores.
+    template<class Type>
+    bool _vector_fill(Type* first, size_t n, const unsigned char* const bytes, const bool non_temporal) noexcept
+    {
+#if defined(__AVX2__) || defined(__SSE2__)
+        constexpr size_t width = sizeof(_stream_vector_t);
+
+        if constexpr (width % sizeof(Type) == 0) {
+            constexpr size_t per_vector = width / sizeof(Type);
+
+            //Note: Streaming stores must be aligned, hence leading objects are copied until first is aligned
+            if (non_temporal) {
+                size_t head = 0;
+                while (head != per_vector && head != n && reinterpret_cast<uintptr_t>(first + head) % width)
+                    ++head;
+
+                if (reinterpret_cast<uintptr_t>(first + head) % width && head != n)
+                    return false;
+
+                for (size_t index = 0; index != head; ++index)
+                    std::memcpy(first + index, bytes, sizeof(Type));
+
+                first += head;
+                n     -= head;
+            }
+
+            unsigned char pattern_bytes[width];
+            for (size_t index = 0; index != per_vector; ++index)
+                std::memcpy(pattern_bytes + index * sizeof(Type), bytes, sizeof(Type));
+
+            const _stream_vector_t pattern = _vector_loadu(pattern_bytes);
+            char* const output = reinterpret_cast<char*>(first);
+
+            size_t index = 0;
+            if (non_temporal) {
+                for (; index + per_vector <= n; index += per_vector)
+                    _vector_stream(output + index * sizeof(Type), pattern);
+
+                //Note: Streaming stores are weakly ordered
+                _mm_sfence();
+            }
+            else {
+                for (; index + per_vector <= n; index += per_vector)
+                    _vector_storeu(output + index * sizeof(Type), pattern);
+            }
+
+            for (; index != n; ++index)
+                std::memcpy(first + index, bytes, sizeof(Type));
+
+            return true;
+        }
+#endif
+        (void)first, (void)n, (void)bytes, (void)non_temporal;
+        return false;
+    }
+
+    //Fills n trivially copyable objects at first with copies of value. Repeated byte patterns (e.g. zero) are
+    //filled through memset, other patterns through vector stores. Fills larger than _non_temporal_threshold
+    //use streaming stores where available.
+    template<class Type>
+    requires(std::is_trivially_copyable_v<Type>)
+    Type* _range_fill(Type* const first, const size_t n, const Type& value) noexcept
     {
-        const size_t bytes_count = right_shift_round_up(std::ranges::distance(first, last), 3);
+        unsigned char bytes[sizeof(Type)];
+        std::memcpy(bytes, std::addressof(value), sizeof(Type));
+
+        bool is_byte_pattern = true;
+        for (size_t index = 1; index != sizeof(Type); ++index)
+            is_byte_pattern &= bytes[index] == bytes[0];
+
+        const bool non_temporal = _non_temporal_threshold <= n * sizeof(Type);
+
+        if (is_byte_pattern && !non_temporal)
+            std::memset(first, bytes[0], n * sizeof(Type));
+        else if (!_vector_fill(first, n, bytes, non_temporal)) {
+            if (is_byte_pattern)
+                std::memset(first, bytes[0], n * sizeof(Type));
+            else
+                for (size_t index = 0; index != n; ++index)
+                    std::memcpy(first + index, bytes, sizeof(Type));
+        }
+
+        return first + n;
+    }
 
-        auto bytes = static_cast<char*>(bits);
 
-        for (size_t index = 0; index < bytes_count - 1; ++index, ++bytes) {
-            unsigned char value = 0;
-            for (unsigned char mask = 1; mask != 0; mask <<= 1, ++first)
-                value |= mask * static_cast<bool>(*first);
+    //Packs [first, last) into words of bits (see expu::_bit_word), returns the end of the words written.
+    //Note: Unused bits of the last word are zeroed.
+    //Note: Contiguous ranges of byte flags (e.g. bool or uint8_t) are packed a word at a time.
+    template<
+        std::input_iterator InputIt,
+        std::sentinel_for<InputIt> Sentinel>
+    constexpr _bit_word* set_bits(_bit_word* bits, InputIt first, const Sentinel last)
+    {
+        if constexpr (std::contiguous_iterator<InputIt> && std::sized_sentinel_for<Sentinel, InputIt> && _byte_flag<std::iter_value_t<InputIt>>) {
+            if (!std::is_constant_evaluated()) {
+                const auto count = static_cast<size_t>(last - first);
+                _pack_bytes(bits, reinterpret_cast<const uint8_t*>(std::to_address(first)), count);
 
-            std::memset(bytes, value, 1);
+                return bits + _bit_word_count(count);
+            }
         }
 
-        unsigned char value = 0;
-        for (unsigned char mask = 1; first != last; mask <<= 1, ++first)
-            value |= mask * static_cast<bool>(*first);
+        while (first != last) {
+            _bit_word word = 0;
+            for (size_t index = 0; index != _bit_word_bits && first != last; ++index, ++first)
+                word |= _bit_word(static_cast<bool>(*first)) << index;
+
+            *bits++ = word;
+        }
 
-        std::memset(bytes, value, 1);
-        return ++bytes;
+        return bits;
     }
 
     template<
         class Alloc,
-        std::contiguous_iterator CtgIt,
-        std::sized_sentinel_for<CtgIt> SizedSentinel> 
-    void* set_bits(Alloc& alloc, void* const bits, CtgIt first, const SizedSentinel last)
+        std::input_iterator InputIt,
+        std::sentinel_for<InputIt> Sentinel>
+    _bit_word* set_bits(Alloc& alloc, _bit_word* const bits, InputIt first, const Sentinel last)
     {
-        void* const result = set_bits(bits, first, last);
+        _bit_word* const result = set_bits(bits, first, last);
         _mark_initialised_if_checked_allocator(alloc, bits, result, true);
 
         return result;
     }
 
+/////////////////////////////////////TRIVIAL RELOCATION///////////////////////////////////////////////////////////////////
+
+    //A type is trivially relocatable if moving an object to a new address, then ending the lifetime of the
+    //original, is equivalent to copying its bytes. Trivially copyable types are always trivially relocatable,
+    //other types (for example, handle types owning a resource) may opt in by specialising this trait.
+    //Note: Types holding pointers into themselves (e.g. libstdc++'s std::string) must NOT opt in!
+    template<class Type>
+    struct is_trivially_relocatable : public std::bool_constant<std::is_trivially_copyable_v<Type>> {};
+
+    template<class Type, class Deleter>
+    struct is_trivially_relocatable<std::unique_ptr<Type, Deleter>> : public is_trivially_relocatable<Deleter> {};
+
+    template<class Type>
+    constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<Type>::value;
+
+
+    //Relocates [first, last) into output. Objects in the input range are considered destroyed after the call,
+    //and should only be deallocated. Ranges may overlap.
+    //Note: Never throws, hence trivially relocatable types always provide the strong guarantee.
+    //Note: src_alloc and dest_alloc are the allocators owning the input and output memory respectively.
+    template<class SrcAlloc, class DestAlloc, class Type>
+    requires(is_trivially_relocatable_v<Type>)
+    constexpr Type* uninitialised_relocate(SrcAlloc& src_alloc, DestAlloc& dest_alloc, Type* first, Type* last, Type* output) noexcept
+    {
+        //Also avoids passing nullptr to memmove
+        if (first == last)
+            return output;
+
+        if (!std::is_constant_evaluated()) {
+            //Note: Mark input uninitialised first, in case the ranges overlap
+            _mark_initialised_if_checked_allocator(src_alloc, first, last, false);
+            Type* const result = _range_memmove(first, last, output);
+            _mark_initialised_if_checked_allocator(dest_alloc, output, result, true);
+
+            return result;
+        }
+
+        //Relocate element by element, in the direction which does not overwrite the input range.
+        //Note: Relational comparison of unrelated pointers is not a constant expression, hence only equality is used.
+        bool output_in_range = false;
+        for (Type* it = first; it != last && !output_in_range; ++it)
+            output_in_range = (it == output);
+
+        if (!output_in_range) {
+            for (; first != last; ++first, ++output) {
+                std::allocator_traits<DestAlloc>::construct(dest_alloc, output, std::move(*first));
+                std::allocator_traits<SrcAlloc>::destroy(src_alloc, first);
+            }
+
+            return output;
+        }
+        else {
+            Type* const result = output + (last - first);
+
+            for (output = result; first != last; ) {
+                std::allocator_traits<DestAlloc>::construct(dest_alloc, --output, std::move(*(--last)));
+                std::allocator_traits<SrcAlloc>::destroy(src_alloc, last);
+            }
+
+            return result;
+        }
+    }
+
+    template<class Alloc, class Type>
+    requires(is_trivially_relocatable_v<Type>)
+    constexpr Type* uninitialised_relocate(Alloc& alloc, Type* const first, Type* const last, Type* const output) noexcept
+    {
+        return uninitialised_relocate(alloc, alloc, first, last, output);
+    }
+
+
 /////////////////////////////////////UNINITIALISED RANGE FUNCTIONS///////////////////////////////////////////////////////////////////
 
     template<
@@ -471,6 +731,26 @@ namespace expu {
         return partial_range.release();
     }
 
+    //As above, though trivially copyable ranges are copied through non-temporal stores regardless of their size.
+    template<
+        class Alloc, 
+        class Type,
+        std::input_iterator InputIt,
+        std::sentinel_for<InputIt> Sentinel>
+    constexpr auto uninitialised_copy(non_temporal_t, Alloc& alloc, InputIt first, Sentinel last, Type* output)
+        noexcept(std::is_nothrow_constructible_v<Type, std::iter_reference_t<InputIt>>)
+    {
+        if constexpr (_actually_trivially<InputIt, Type*, Sentinel>::constructible) {
+            if (!std::is_constant_evaluated()) {
+                auto result = _range_stream_memcpy(_unwrapped(first), _unwrapped(last), output);
+                _mark_initialised_if_checked_allocator(alloc, output, result, true);
+                return result;
+            }
+        }
+
+        return uninitialised_copy(alloc, std::move(first), std::move(last), output);
+    }
+
     template<
         class Alloc,
         class Type,
@@ -510,11 +790,21 @@ namespace expu {
             output);
     }
 
-    //Todo: memset for compatible types
+    //Note: Trivially copyable objects constructible from value are filled in bulk, see expu::_range_fill.
     template<class Type, class Alloc, class DestType>
     constexpr void uninitialised_fill(Alloc& alloc, DestType* first, const DestType* const last, const Type& value)
         noexcept(std::is_nothrow_constructible_v<DestType, Type>)
     {
+        if constexpr (std::is_trivially_copyable_v<DestType> && std::is_trivially_constructible_v<DestType, const Type&>) {
+            if (!std::is_constant_evaluated()) {
+                const DestType pattern(value);
+
+                _range_fill(first, static_cast<size_t>(last - first), pattern);
+                _mark_initialised_if_checked_allocator(alloc, first, last, true);
+                return;
+            }
+        }
+
         _partial_range<Alloc, Type> partial_range(alloc, first);
         for (; first != last; ++first)
             partial_range.emplace_back(value);
@@ -522,11 +812,20 @@ namespace expu {
         partial_range.release();
     }
 
-    //Todo: memset for compatible types
     template<class Type, class Alloc, class DestType>
     constexpr auto uninitialised_fill_n(Alloc& alloc, DestType* first, size_t n, const Type& value)
         noexcept(std::is_nothrow_constructible_v<DestType, Type>)
     {
+        if constexpr (std::is_trivially_copyable_v<DestType> && std::is_trivially_constructible_v<DestType, const Type&>) {
+            if (!std::is_constant_evaluated()) {
+                const DestType pattern(value);
+
+                DestType* const result = _range_fill(first, n, pattern);
+                _mark_initialised_if_checked_allocator(alloc, first, result, true);
+                return result;
+            }
+        }
+
         _partial_range<Alloc, Type> partial_range(alloc, first);
         while(n--)
             partial_range.emplace_back(value);
@@ -535,6 +834,37 @@ namespace expu {
     }
 
 
+    //Value-initialises n objects at first, as allocator_traits::construct(alloc, ptr) does.
+    template<class Alloc, class Type>
+    constexpr Type* uninitialised_value_construct_n(Alloc& alloc, Type* first, size_t n)
+        noexcept(std::is_nothrow_default_constructible_v<Type>)
+    {
+        _partial_range<Alloc, Type> partial_range(alloc, first);
+        while (n--)
+            partial_range.emplace_back();
+
+        return partial_range.release();
+    }
+
+    //Default-initialises n objects at first. Trivially default constructible objects are left with indeterminate
+    //values, hence no memory is written (e.g. when resizing a buffer which is about to be overwritten).
+    //Note: Default-initialisation bypasses allocator's construct function, for trivial types.
+    template<class Alloc, class Type>
+    constexpr Type* uninitialised_default_construct_n(Alloc& alloc, Type* first, size_t n)
+        noexcept(std::is_nothrow_default_constructible_v<Type>)
+    {
+        if constexpr (std::is_trivially_default_constructible_v<Type>) {
+            //Objects must be constructed to be usable during constant evaluation
+            if (!std::is_constant_evaluated()) {
+                _mark_initialised_if_checked_allocator(alloc, first, first + n, true);
+                return first + n;
+            }
+        }
+
+        return uninitialised_value_construct_n(alloc, first, n);
+    }
+
+
 /////////////////////////////////////INITIALISED RANGE FUNCTIONS///////////////////////////////////////////////////////////////////
 
 
@@ -557,6 +887,20 @@ namespace expu {
         return output;
     }
 
+    //As above, though trivially copyable ranges are copied through non-temporal stores regardless of their size.
+    template<
+        std::input_iterator InputIt,
+        std::sentinel_for<InputIt> Sentinel,
+        _output_iterator_for<InputIt> OutIt>
+    constexpr OutIt copy(non_temporal_t, InputIt first, Sentinel last, OutIt output) {
+        if constexpr (_actually_trivially<InputIt, OutIt, Sentinel>::assignable) {
+            if (!std::is_constant_evaluated())
+                return _range_stream_memmove(_unwrapped(first), _unwrapped(last), output);
+        }
+
+        return expu::copy(std::move(first), std::move(last), std::move(output));
+    }
+
     template<
         std::input_iterator InputIt,
         std::sentinel_for<InputIt> Sentinel,
@@ -600,6 +944,43 @@ namespace expu {
             output);
     }
 
+    //Assigns value to each of the n objects at first, returning the end of the range.
+    //Note: Contiguous ranges of trivially copyable objects are filled in bulk, see expu::_range_fill.
+    template<class Type, std::output_iterator<const Type&> OutIt>
+    constexpr OutIt fill_n(OutIt first, size_t n, const Type& value)
+    {
+        using _value_type = std::iter_value_t<OutIt>;
+
+        if constexpr (std::contiguous_iterator<OutIt> && std::is_trivially_copyable_v<_value_type> &&
+                      std::is_trivially_constructible_v<_value_type, const Type&> && std::is_trivially_assignable_v<_value_type&, const Type&>) {
+            if (!std::is_constant_evaluated()) {
+                const _value_type pattern(value);
+
+                _range_fill(std::to_address(first), n, pattern);
+                return first + static_cast<std::iter_difference_t<OutIt>>(n);
+            }
+        }
+
+        for (; n; --n, ++first)
+            *first = value;
+
+        return first;
+    }
+
+    template<class Type, std::forward_iterator FwdIt, std::sentinel_for<FwdIt> Sentinel>
+    requires(std::output_iterator<FwdIt, const Type&>)
+    constexpr FwdIt fill(FwdIt first, const Sentinel last, const Type& value)
+    {
+        if constexpr (std::contiguous_iterator<FwdIt> && std::sized_sentinel_for<Sentinel, FwdIt>)
+            return expu::fill_n(first, static_cast<size_t>(last - first), value);
+        else {
+            for (; first != last; ++first)
+                *first = value;
+
+            return first;
+        }
+    }
+
     template<
         std::input_iterator InputIt,
         _output_iterator_for<InputIt> OutIt,
@@ -607,8 +988,13 @@ namespace expu {
     constexpr InputIt copy_until_sentinel(InputIt first, OutIt out_first, Sentinel out_last)
     {
         if constexpr (_actually_trivially<InputIt, OutIt>::assignable && std::sized_sentinel_for<Sentinel, OutIt>) {
-            if (!std::is_constant_evaluated()) 
-                return _range_memmove(_unwrapped(first), _unwrapped(first) + (out_last - out_first), out_first);
+            if (!std::is_constant_evaluated()) {
+                const auto count = out_last - out_first;
+
+                //Note: Must return the advanced input iterator, not the end of the output range.
+                _range_memmove(_unwrapped(first), _unwrapped(first) + count, out_first);
+                return std::ranges::next(first, count);
+            }
         }
 
         for (; out_first != out_last; ++first, ++out_first)
@@ -617,6 +1003,9 @@ namespace expu {
         return first;
     }
 
+    //Allocates capacity objects into output and copies [first, last) into them.
+    //Note: The new buffer never overlaps the source, hence trivially copyable ranges larger than
+    //_non_temporal_threshold (e.g. darray copies taken as snapshots) are streamed past the cache.
     template<
         std::input_iterator InputIt,
         std::sentinel_for<InputIt> Sentinel,
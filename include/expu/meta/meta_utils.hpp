@@ -3,6 +3,7 @@
 
 #include <type_traits>
 #include <memory>
+#include <concepts>
 
 namespace expu {
 
@@ -45,6 +46,22 @@ namespace expu {
     template<class Alloc>
     using _alloc_size_t = typename std::allocator_traits<Alloc>::size_type;
 
+
+    //Optional allocator extension: Attempts to grow the block [ptr, ptr + n) to new_n elements without
+    //moving it, returning false (leaving the block untouched) on failure.
+    template<class Alloc>
+    concept _alloc_can_try_expand = requires(Alloc& alloc, _alloc_ptr_t<Alloc> ptr, _alloc_size_t<Alloc> n) {
+        { alloc.try_expand(ptr, n, n) } -> std::convertible_to<bool>;
+    };
+
+    //Optional allocator extension: Grows the block [ptr, ptr + n) to new_n elements, possibly moving it,
+    //without copying its contents element by element. The old block is invalidated on success.
+    //Note: Contents are relocated bytewise, hence may only be used with trivially relocatable types.
+    template<class Alloc>
+    concept _alloc_can_reallocate = requires(Alloc& alloc, _alloc_ptr_t<Alloc> ptr, _alloc_size_t<Alloc> n) {
+        { alloc.reallocate(ptr, n, n) } -> std::same_as<_alloc_ptr_t<Alloc>>;
+    };
+
     /*
     //Todo: Add checks for optional features!
     template<class Alloc>
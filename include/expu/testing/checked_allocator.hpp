@@ -121,6 +121,10 @@ namespace expu {
         using propagate_on_container_move_assignment = typename _alloc_traits::propagate_on_container_move_assignment;
         using propagate_on_container_swap            = typename _alloc_traits::propagate_on_container_swap;
 
+        //Note: Required, as allocator_traits cannot rebind allocators with non-type template parameters
+        template<class OtherType>
+        struct rebind { using other = _checked_allocator<typename _alloc_traits::template rebind_alloc<OtherType>, _throw_on_trivial>; };
+
     public: //Constructors and destructor
         using _checked_allocator_base::_allocated_memory;
 
@@ -160,6 +164,7 @@ namespace expu {
                     _check_cleared();
             }
 
+            _allocated_memory = other._allocated_memory;
             return *this;
         }
 
@@ -211,7 +216,10 @@ namespace expu {
             auto loc = _allocated_memory->find(std::to_address(pointer));
 
             EXPU_VERIFY(loc != _allocated_memory->end(), "Trying to deallocated memory which has not been allocated!");
-            EXPU_VERIFY(_comp_equal(loc->second.owner) , "Cannot deallocate memory, this allocator does not compare equal to allocator which allocated this segment.");
+            //Note: The owner may since have been destroyed (e.g. a moved-from container), which is only of consequence
+            //to allocators which do not always compare equal
+            if constexpr (!is_always_equal::value)
+                EXPU_VERIFY(_comp_equal(loc->second.owner) , "Cannot deallocate memory, this allocator does not compare equal to allocator which allocated this segment.");
 
             _init_memory_container& initialised = loc->second.initialised;
 
@@ -226,6 +234,55 @@ namespace expu {
             _allocated_memory->erase(loc);
         }
 
+    private:
+        //Replaces the memory tracked at loc with size bytes starting at new_address, preserving
+        //what has been marked as initialised.
+        void _retrack(const _map_type::iterator loc, const void* const new_address, const size_t size)
+        {
+            _memory new_memory(this, size);
+
+            const _init_memory_container& initialised = loc->second.initialised;
+            for (size_t at = 0; at < initialised.size() && at < size; ++at)
+                new_memory.initialised[at] = initialised[at];
+
+            _allocated_memory->erase(loc);
+            _allocated_memory->try_emplace(new_address, std::move(new_memory));
+        }
+
+        [[nodiscard]] _map_type::iterator _find_allocated(const pointer pointer, const size_type n)
+        {
+            auto loc = _allocated_memory->find(std::to_address(pointer));
+
+            EXPU_VERIFY(loc != _allocated_memory->end(), "Trying to grow memory which has not been allocated!");
+            EXPU_VERIFY(loc->second.initialised.size() == _byte_size(n), "Trying to grow memory with incorrect size!");
+
+            return loc;
+        }
+
+    public: //Allocator extensions, only provided if the wrapped allocator does
+        [[nodiscard]] bool try_expand(const pointer pointer, const size_type n, const size_type new_n)
+            requires(_alloc_can_try_expand<Allocator>)
+        {
+            const auto loc = _find_allocated(pointer, n);
+
+            if (!Allocator::try_expand(pointer, n, new_n))
+                return false;
+
+            _retrack(loc, std::to_address(pointer), _byte_size(new_n));
+            return true;
+        }
+
+        [[nodiscard]] pointer reallocate(const pointer pointer, const size_type n, const size_type new_n)
+            requires(_alloc_can_reallocate<Allocator>)
+        {
+            const auto loc = _find_allocated(pointer, n);
+
+            const auto result = Allocator::reallocate(pointer, n, new_n);
+
+            _retrack(loc, std::to_address(result), _byte_size(new_n));
+            return result;
+        }
+
     public: //Construction and destruction functions
         template<class Type, class ... Args>
         void construct(Type* const xp, Args&& ... args)
@@ -323,6 +380,10 @@ namespace expu {
     public:
         void _mark_initialised(const void* const first, const void* const last, bool value)
         {
+            //Note: Empty ranges need not lie within allocated memory, e.g. destroying no elements of an empty array
+            if (first == last)
+                return;
+
             const _map_type::iterator loc = _mem_first(first);
             _init_memory_container& initialised = loc->second.initialised;
 
@@ -0,0 +1,136 @@
+#include "gtest/gtest.h"
+
+#include <bit>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "expu/containers/adaptive_map.hpp"
+#include "expu/containers/darray.hpp"
+
+
+//Hash sending keys to few slots, hence building long probe runs which erasions must shift back.
+struct _colliding_hash
+{
+    size_t operator()(const int key) const noexcept { return static_cast<size_t>(key % 3); }
+};
+
+//Applies the same random insertions and erasions to the map and to a std::unordered_map, growing the map past
+//its threshold and shrinking it back below half of it, checking that both hold the same elements.
+template<class Map, class Key>
+static void _verify_against_unordered_map(Key (*make_key)(int))
+{
+    std::mt19937 generator(Map::threshold);
+    std::unordered_map<Key, int> expected;
+    Map map;
+
+    bool was_hashed = false;
+
+    for (const int key_range : { 4, 64, 256, 8 }) {
+        std::uniform_int_distribution<int> keys(0, 2 * key_range);
+
+        for (int step = 0; step != 2000; ++step) {
+            const int key = keys(generator);
+
+            if (expected.size() < static_cast<size_t>(key_range) ? step % 4 != 0 : step % 4 == 0) {
+                const bool inserted = expected.try_emplace(make_key(key), step).second;
+                ASSERT_EQ(map.try_emplace(make_key(key), step).second, inserted);
+            }
+            else {
+                expected.erase(make_key(key));
+                map.erase(make_key(key));
+            }
+
+            ASSERT_EQ(map.size(), expected.size());
+            ASSERT_EQ(map.hashed() && map.size() <= Map::threshold / 2, false);
+            was_hashed |= map.hashed();
+        }
+
+        for (int key = 0; key <= 2 * key_range + 1; ++key) {
+            const auto loc = expected.find(make_key(key));
+
+            if (loc == expected.end())
+                ASSERT_FALSE(map.contains(make_key(key)));
+            else
+                ASSERT_EQ(map.at(make_key(key)), loc->second);
+        }
+    }
+
+    EXPECT_TRUE(was_hashed);
+
+    for (const auto& [key, mapped] : expected)
+        map.erase(key);
+
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.hashed());
+}
+
+static int         _make_int(const int key)    { return key * 7; }
+static std::string _make_string(const int key) { return "key " + std::to_string(key); }
+
+//Keys differing only in their high bits, which the index must still spread over its slots
+static uint64_t _make_high_bits(const int key) { return static_cast<uint64_t>(key) << 48; }
+
+TEST(adaptive_map_tests, matches_unordered_map)
+{
+    _verify_against_unordered_map<expu::adaptive_map<int, int>>(_make_int);
+    _verify_against_unordered_map<expu::adaptive_map<int, int, 0>>(_make_int);
+    _verify_against_unordered_map<expu::adaptive_map<int, int, 5, _colliding_hash>>(_make_int);
+    _verify_against_unordered_map<expu::adaptive_map<std::string, int, 8>>(_make_string);
+    _verify_against_unordered_map<expu::adaptive_map<uint64_t, int>>(_make_high_bits);
+    _verify_against_unordered_map<expu::adaptive_map<int, int, 16, std::hash<int>, std::equal_to<int>, expu::darray<std::pair<int, int>>>>(_make_int);
+}
+
+TEST(adaptive_map_tests, switches_to_hashing_past_threshold)
+{
+    expu::adaptive_map<int, std::string, 4> map{ { 1, "one" }, { 2, "two" }, { 3, "three" }, { 4, "four" }, { 1, "uno" } };
+
+    EXPECT_EQ(map.size(), 4);
+    EXPECT_FALSE(map.hashed());
+    EXPECT_EQ(map[1], "one");
+
+    map[5] = "five";
+    EXPECT_TRUE(map.hashed());
+
+    //Elements stay where they were, as the index is built over the same storage
+    EXPECT_EQ(map.begin()->second, "one");
+    EXPECT_EQ(std::prev(map.end())->second, "five");
+
+    const expu::adaptive_map<int, std::string, 4> same{ { 5, "five" }, { 4, "four" }, { 3, "three" }, { 2, "two" }, { 1, "one" } };
+    EXPECT_EQ(map, same);
+
+    map.erase(4);
+    map.erase(5);
+    map.erase(6);
+    EXPECT_TRUE(map.hashed());
+    EXPECT_NE(map, same);
+
+    map.erase(3);
+    EXPECT_FALSE(map.hashed());
+    EXPECT_EQ(map.at(2), "two");
+    EXPECT_THROW((void)map.at(3), std::out_of_range);
+}
+
+TEST(adaptive_map_tests, spreads_keys_differing_in_high_bits)
+{
+    constexpr int test_size = 20000;
+
+    //Note: std::hash of integers is the identity, hence home slots only differ if mixing brings the high bits down
+    std::unordered_set<size_t> homes;
+    for (int key = 0; key < test_size; ++key)
+        homes.insert(expu::_mix_hash(static_cast<size_t>(_make_high_bits(key))) & (std::bit_ceil(size_t(4 * test_size)) - 1));
+
+    ASSERT_GT(homes.size(), test_size / 2);
+
+    expu::adaptive_map<uint64_t, int> map;
+    for (int key = 0; key < test_size; ++key)
+        ASSERT_TRUE(map.try_emplace(_make_high_bits(key), key).second);
+
+    ASSERT_TRUE(map.hashed());
+
+    for (int key = 0; key < test_size; ++key)
+        ASSERT_EQ(map.at(_make_high_bits(key)), key);
+}
\ No newline at end of file
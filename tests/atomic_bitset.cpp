@@ -0,0 +1,74 @@
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "expu/containers/atomic_bitset.hpp"
+#include "expu/containers/fixed_array.hpp"
+
+
+TEST(atomic_bitset_tests, single_thread)
+{
+    expu::atomic_bitset<> bits(130);
+
+    ASSERT_FALSE(bits.test_and_set(0));
+    ASSERT_TRUE(bits.test_and_set(0));
+    ASSERT_FALSE(bits.test_and_set(129));
+
+    bits.set(64);
+    ASSERT_TRUE(bits[64]);
+    ASSERT_EQ(bits.count(), 3u);
+
+    ASSERT_TRUE(bits.test_and_reset(64));
+    ASSERT_FALSE(bits.test_and_reset(64));
+    ASSERT_FALSE(bits[64]);
+
+    const expu::fixed_array<bool> snapshot = bits.snapshot();
+    ASSERT_EQ(snapshot.size(), 130u);
+    ASSERT_EQ(snapshot.count(), 2u);
+    ASSERT_TRUE(snapshot[0] && snapshot[129]);
+
+    expu::fixed_array<bool> other(130, false);
+    other[1] = true;
+    other[129] = true;
+
+    bits.merge(other);
+    ASSERT_EQ(bits.count(), 3u);
+    ASSERT_TRUE(bits[1]);
+
+    const expu::fixed_array<bool> released = bits.release();
+    ASSERT_EQ(released.count(), 3u);
+    ASSERT_EQ(bits.size(), 0u);
+}
+
+TEST(atomic_bitset_tests, concurrent_marking)
+{
+    //Note: Prime, hence coprime with every thread's stride
+    constexpr size_t test_size    = 100003;
+    constexpr size_t thread_count = 8;
+
+    expu::atomic_bitset<> visited(test_size);
+    std::atomic<size_t> first_visits = 0;
+
+    //Every thread visits every element, in different orders, such that neighbouring bits are set concurrently
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < thread_count; ++thread) {
+        threads.emplace_back([&, thread] {
+            size_t local_visits = 0;
+
+            for (size_t i = 0; i < test_size; ++i)
+                if (!visited.test_and_set((i * (2 * thread + 1) + thread) % test_size))
+                    ++local_visits;
+
+            first_visits += local_visits;
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(first_visits.load(), test_size);
+    ASSERT_EQ(visited.count(), test_size);
+    ASSERT_TRUE(visited.snapshot().all());
+}
@@ -2,11 +2,22 @@
 
 #include <memory>
 #include <algorithm>
+#include <cstring>
+#include <list>
+#include <numeric>
+#include <ranges>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "expu/containers/darray.hpp"
 #include "expu/containers/fixed_array.hpp"
 
+#include "expu/allocators/arena.hpp"
+#include "expu/allocators/page_allocator.hpp"
+#include "expu/allocators/pool_allocator.hpp"
+
 #include "expu/iterators/concatenated_iterator.hpp"
 #include "expu/iterators/seq_iter.hpp"
 
@@ -27,8 +38,8 @@ using checked_darray = expu::darray<Type, expu::checked_allocator<Alloc<Type, Ex
 //////////////////////////////////////DARRAY CHECKS///////////////////////////////////////////////////////////////////////////////
 
 
-template<class Type, class Alloc, std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
-testing::AssertionResult is_equal(const expu::darray<Type, Alloc>& arr, InputIt first, const Sentinel last)
+template<class Type, class Alloc, class GrowthPolicy, std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+testing::AssertionResult is_equal(const expu::darray<Type, Alloc, GrowthPolicy>& arr, InputIt first, const Sentinel last)
 {
     size_t range_size = 0;
 
@@ -708,4 +719,368 @@ TYPED_TEST(darray_trivial_iterator_tests, insert_with_enough_capacity)
 
     _insert_iterator_test_common<array_type, typename TestFixture::iterator_category>(
         test_size, insert_size, test_size * 2, 10, _insert_pre_check<array_type, false, insert_size>{});
-}
\ No newline at end of file
+}
+
+//////////////////////////////////////DARRAY TRIVIAL RELOCATION TESTS///////////////////////////////////////////////////////////////////////////////
+
+
+TEST(darray_tests, trivially_relocatable_grow_insert_erase)
+{
+    using value_type  = std::unique_ptr<int>;
+    using darray_type = checked_darray<value_type, std::allocator>;
+
+    static_assert(expu::is_trivially_relocatable_v<value_type> && !std::is_trivially_copyable_v<value_type>,
+        "Test requires a trivially relocatable, but not trivially copyable, type!");
+
+    constexpr int test_size = 10000;
+
+    darray_type arr;
+    for (int i = 0; i < test_size; ++i)
+        arr.push_back(std::make_unique<int>(i));
+
+    ASSERT_TRUE(is_darray_valid(arr));
+
+    //Insert at front, forcing every element to be shifted
+    arr.emplace(arr.cbegin(), std::make_unique<int>(-1));
+    ASSERT_TRUE(is_darray_valid(arr));
+    ASSERT_EQ(*arr[0], -1);
+
+    //Erase front, and a range in the middle
+    arr.erase(arr.cbegin());
+    arr.erase(arr.cbegin() + test_size / 4, arr.cbegin() + test_size / 2);
+    ASSERT_TRUE(is_darray_valid(arr));
+    ASSERT_EQ(arr.size(), test_size - test_size / 4);
+
+    arr.shrink_to_fit();
+    ASSERT_TRUE(is_darray_valid(arr));
+    ASSERT_EQ(arr.capacity(), arr.size());
+
+    for (int i = 0; i < test_size / 4; ++i)
+        ASSERT_EQ(*arr[i], i);
+
+    for (int i = test_size / 4; i < static_cast<int>(arr.size()); ++i)
+        ASSERT_EQ(*arr[i], i + test_size / 4);
+}
+
+
+//////////////////////////////////////DARRAY ALLOCATOR EXTENSION TESTS///////////////////////////////////////////////////////////////////////////////
+
+
+TEST(darray_tests, grow_with_page_allocator)
+{
+    //Note: On linux, page_allocator grows through try_expand and reallocate.
+    using darray_type = checked_darray<std::unique_ptr<int>, expu::page_allocator>;
+
+    constexpr int test_size = 100000;
+
+    darray_type arr;
+    for (int i = 0; i < test_size; ++i)
+        arr.push_back(std::make_unique<int>(i));
+
+    arr.reserve(test_size * 4);
+    ASSERT_EQ(arr.capacity(), test_size * 4);
+    ASSERT_TRUE(is_darray_valid(arr));
+
+    for (int i = 0; i < test_size; ++i)
+        ASSERT_EQ(*arr[i], i);
+}
+
+
+TEST(darray_tests, grow_with_huge_page_allocator)
+{
+    using darray_type = checked_darray<std::unique_ptr<int>, expu::huge_page_allocator>;
+
+    constexpr int test_size = 300000;
+
+    darray_type arr;
+    for (int i = 0; i < test_size; ++i) {
+        arr.push_back(std::make_unique<int>(i));
+
+        //Alignment must be preserved when blocks are moved by reallocate
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(&arr[0]) % expu::huge_page_size, 0);
+    }
+
+    ASSERT_TRUE(is_darray_valid(arr));
+
+    for (int i = 0; i < test_size; ++i)
+        ASSERT_EQ(*arr[i], i);
+}
+
+TEST(darray_tests, arena_allocator)
+{
+    using allocator_type = expu::arena_allocator<std::string>;
+    using darray_type    = expu::darray<std::string, allocator_type>;
+
+    expu::arena first_arena(256), second_arena;
+
+    darray_type arr{ allocator_type(first_arena) };
+    for (int i = 0; i < 1000; ++i)
+        arr.emplace_back(std::to_string(i));
+
+    //Allocators never propagate, hence elements are copied (or moved) between arenas
+    darray_type other{ allocator_type(second_arena) };
+    other = arr;
+    ASSERT_EQ(other.get_allocator(), allocator_type(second_arena));
+    ASSERT_TRUE(std::equal(arr.begin(), arr.end(), other.begin(), other.end()));
+
+    darray_type moved{ allocator_type(second_arena) };
+    moved = std::move(arr);
+    ASSERT_EQ(moved.get_allocator(), allocator_type(second_arena));
+    ASSERT_TRUE(std::equal(moved.begin(), moved.end(), other.begin(), other.end()));
+
+    //Copy construction shares the arena
+    darray_type copy(other);
+    ASSERT_EQ(copy.get_allocator(), allocator_type(second_arena));
+}
+
+TEST(darray_tests, pool_allocator)
+{
+    using darray_type = checked_darray<std::unique_ptr<int>, expu::pool_allocator>;
+
+    //Spans every size class, as well as blocks too large to be pooled
+    constexpr int test_size = 2000;
+
+    darray_type arr;
+    for (int i = 0; i < test_size; ++i)
+        arr.push_back(std::make_unique<int>(i));
+
+    ASSERT_TRUE(is_darray_valid(arr));
+
+    const expu::fixed_array<int, expu::pool_allocator<int>> copy(expu::seq_iter(0), expu::seq_iter(test_size));
+    for (int i = 0; i < test_size; ++i) {
+        ASSERT_EQ(*arr[i], i);
+        ASSERT_EQ(copy[i], i);
+    }
+}
+
+TEST(darray_tests, pool_allocator_thread_teardown)
+{
+    //Thread local darrays constructed before their thread's first pooled allocation are destroyed after the
+    //thread abandons its cache, hence free their blocks onto remote lists. Threads then adopt the abandoned
+    //caches concurrently with those frees.
+    const auto worker = [] {
+        thread_local expu::darray<int, expu::pool_allocator<int>> arr;
+
+        for (int i = 0; i < 1000; ++i)
+            arr.emplace_back(i);
+
+        for (int i = 0; i < 1000; ++i)
+            ASSERT_EQ(arr[i], i);
+    };
+
+    for (int round = 0; round < 8; ++round) {
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < 4; ++thread)
+            threads.emplace_back(worker);
+
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+}
+
+TEST(darray_tests, pool_allocator_remote_free)
+{
+    using darray_type = expu::darray<int, expu::pool_allocator<int>>;
+
+    constexpr int test_size = 100;
+
+    //Arrays are allocated on one thread and freed on another
+    std::vector<darray_type> arrays;
+    std::thread([&] {
+        for (int i = 0; i < test_size; ++i)
+            arrays.emplace_back(expu::seq_iter(0), expu::seq_iter(i));
+    }).join();
+
+    arrays.clear();
+
+    //Remote frees are reclaimed by the (adopted) owning thread
+    std::thread([&] {
+        for (int i = 0; i < test_size; ++i) {
+            arrays.emplace_back(expu::seq_iter(0), expu::seq_iter(i));
+            ASSERT_TRUE(std::ranges::equal(arrays.back(), std::views::iota(0, i)));
+        }
+    }).join();
+}
+
+//////////////////////////////////////DARRAY GROWTH POLICY TESTS///////////////////////////////////////////////////////////////////////////////
+
+
+TEST(darray_tests, growth_policies)
+{
+    static_assert(expu::geometric_growth<>::next_capacity(10, 11, 1000, 4) == 15);
+    static_assert(expu::geometric_growth<>::next_capacity(900, 901, 1000, 4) == 1000,
+        "Growth should be clamped to max_size!");
+
+    static_assert(expu::doubling_growth::next_capacity(10, 11, 1000, 4) == 20);
+    static_assert(expu::page_rounded_growth<>::next_capacity(10, 11, 100000, 4) == 1024);
+    static_assert(expu::capped_growth<100>::next_capacity(1000, 1001, 100000, 4) == 1100);
+
+    expu::darray<int, std::allocator<int>, expu::doubling_growth> arr;
+    for (int i = 0; i < 1000; ++i)
+        arr.push_back(i);
+
+    ASSERT_EQ(arr.capacity(), 1024);
+    ASSERT_TRUE(is_equal(arr, expu::seq_iter(0), expu::seq_iter(1000)));
+}
+
+
+//////////////////////////////////////DARRAY RESIZE TESTS///////////////////////////////////////////////////////////////////////////////
+
+
+TEST(darray_tests, resize)
+{
+    checked_darray<int, std::allocator> arr;
+
+    arr.resize(100);
+    ASSERT_TRUE(std::all_of(arr.begin(), arr.end(), [](const int value) { return value == 0; }));
+
+    //Value refers to an element of the array, which is invalidated by growth
+    arr[99] = 7;
+    arr.resize(1000, arr[99]);
+    ASSERT_EQ(arr.size(), 1000);
+    ASSERT_TRUE(std::all_of(arr.begin() + 99, arr.end(), [](const int value) { return value == 7; }));
+
+    arr.resize(10);
+    ASSERT_EQ(arr.size(), 10);
+    ASSERT_TRUE(is_darray_valid(arr));
+}
+
+TEST(darray_tests, append_for_overwrite)
+{
+    checked_darray<int, std::allocator> arr;
+    arr.resize_for_overwrite(10);
+    std::iota(arr.begin(), arr.end(), 0);
+
+    const std::span<int> appended = arr.append_for_overwrite(90);
+    ASSERT_EQ(appended.size(), 90);
+    ASSERT_EQ(appended.data(), &arr[10]);
+
+    std::iota(appended.begin(), appended.end(), 10);
+    ASSERT_TRUE(is_equal(arr, expu::seq_iter(0), expu::seq_iter(100)));
+    ASSERT_TRUE(is_darray_valid(arr));
+}
+
+
+//////////////////////////////////////FILL TESTS///////////////////////////////////////////////////////////////////////////////
+
+
+//Fills through each path of expu::_range_fill: byte patterns, vector stores, odd sized objects and (as the tests
+//lower EXPU_NON_TEMPORAL_THRESHOLD) streaming stores from aligned and unaligned starts.
+template<class Type>
+static void _verify_fill(const Type& value, const Type& other)
+{
+    for (const size_t test_size : { 0, 1, 5, 33, 1000, 10000 }) {
+        for (const size_t offset : { 0, 1 }) {
+            std::vector<Type> values(test_size + offset + 1, other);
+            expu::fill(values.begin() + offset, values.end() - 1, value);
+
+            for (size_t i = 0; i < values.size(); ++i) {
+                const bool filled = offset <= i && i < offset + test_size;
+                ASSERT_EQ(std::memcmp(&values[i], filled ? &value : &other, sizeof(Type)), 0) << "At index: " << i;
+            }
+        }
+
+        checked_darray<Type, std::allocator> arr;
+        arr.resize(test_size, value);
+        ASSERT_TRUE(std::all_of(arr.begin(), arr.end(), [&](const Type& elem) { return std::memcmp(&elem, &value, sizeof(Type)) == 0; }));
+    }
+}
+
+struct _odd_sized { char bytes[3]; };
+
+TEST(fill_tests, trivially_copyable_patterns)
+{
+    _verify_fill<char>('a', 'b');
+    _verify_fill<int>(0, -1);
+    _verify_fill<int>(0x01020304, 0);
+    _verify_fill<uint16_t>(0x0102, 7);
+    _verify_fill<double>(1.5, 0.0);
+    _verify_fill<_odd_sized>({ 1, 2, 3 }, { 4, 5, 6 });
+
+    //Values are converted to the range's value type
+    std::vector<double> doubles(100, 0.0);
+    ASSERT_EQ(expu::fill(doubles.begin(), doubles.end(), 2), doubles.end());
+    ASSERT_TRUE(std::ranges::all_of(doubles, [](const double value) { return value == 2.0; }));
+}
+
+TEST(fill_tests, non_contiguous_and_non_trivial)
+{
+    std::list<int> values(10, 0);
+    expu::fill(values.begin(), values.end(), 3);
+    ASSERT_TRUE(std::ranges::all_of(values, [](const int value) { return value == 3; }));
+
+    std::vector<std::string> strings(10);
+    ASSERT_EQ(expu::fill_n(strings.begin(), 5, std::string("test")), strings.begin() + 5);
+    ASSERT_EQ(std::ranges::count(strings, "test"), 5);
+}
+
+
+//////////////////////////////////////STREAMING COPY TESTS///////////////////////////////////////////////////////////////////////////////
+
+
+//The tests lower EXPU_NON_TEMPORAL_THRESHOLD, hence larger copies below are streamed automatically.
+TEST(streaming_copy_tests, copies_and_overlaps)
+{
+    for (const size_t test_size : { 0, 1, 7, 33, 1000, 10000 }) {
+        std::vector<int> values(test_size + 2);
+        std::iota(values.begin(), values.end(), 0);
+
+        //Unaligned sources and destinations, explicitly and automatically streamed
+        for (const size_t offset : { 0, 1 }) {
+            std::vector<int> output(test_size + 2, -1);
+
+            ASSERT_EQ(expu::copy(expu::non_temporal, values.begin() + offset, values.begin() + offset + test_size, output.begin() + 1), output.begin() + 1 + test_size);
+            ASSERT_TRUE(std::equal(output.begin() + 1, output.begin() + 1 + test_size, values.begin() + offset));
+            ASSERT_EQ(output.front(), -1);
+            ASSERT_EQ(output.back(),  -1);
+
+            std::ranges::fill(output, -1);
+            expu::copy(values.begin() + offset, values.begin() + offset + test_size, output.begin() + 1);
+            ASSERT_TRUE(std::equal(output.begin() + 1, output.begin() + 1 + test_size, values.begin() + offset));
+        }
+
+        //Overlapping ranges fall back to memmove
+        std::vector<int> shifted = values;
+        expu::copy(expu::non_temporal, shifted.begin(), shifted.begin() + test_size, shifted.begin() + 1);
+        ASSERT_TRUE(std::equal(shifted.begin() + 1, shifted.begin() + 1 + test_size, values.begin()));
+
+        expu::copy(shifted.begin() + 1, shifted.begin() + 1 + test_size, shifted.begin());
+        ASSERT_TRUE(std::equal(shifted.begin(), shifted.begin() + test_size, values.begin()));
+
+        //Copies of darrays are duplicated through _ctg_duplicate
+        const checked_darray<int, std::allocator> arr(values.begin(), values.end());
+        const checked_darray<int, std::allocator> copy(arr);
+        ASSERT_TRUE(std::ranges::equal(arr, copy));
+    }
+}
+
+
+//////////////////////////////////////DARRAY RANGE TESTS///////////////////////////////////////////////////////////////////////////////
+
+
+TEST(darray_tests, append_insert_assign_range)
+{
+    checked_darray<int, std::allocator> arr;
+
+    const std::vector<int> values{ 0, 1, 2, 3 };
+    arr.append_range(values);
+    arr.append_range(std::list<int>{ 8, 9 });
+
+    const auto inserted = arr.insert_range(arr.begin() + 4, std::views::iota(4, 8));
+    ASSERT_EQ(inserted, arr.begin() + 4);
+    ASSERT_TRUE(is_equal(arr, expu::seq_iter(0), expu::seq_iter(10)));
+
+    //Input only range
+    std::istringstream stream("10 11 12");
+    arr.append_range(std::views::istream<int>(stream));
+    ASSERT_TRUE(is_equal(arr, expu::seq_iter(0), expu::seq_iter(13)));
+
+    //Range refers to the array itself, which must grow
+    arr.append_range(arr);
+    ASSERT_EQ(arr.size(), 26);
+    ASSERT_TRUE(std::equal(arr.begin(), arr.begin() + 13, arr.begin() + 13, arr.end()));
+
+    arr.assign_range(std::views::iota(0, 100));
+    ASSERT_TRUE(is_equal(arr, expu::seq_iter(0), expu::seq_iter(100)));
+    ASSERT_TRUE(is_darray_valid(arr));
+}
@@ -1,10 +1,354 @@
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "expu/allocators/arena.hpp"
+#include "expu/allocators/page_allocator.hpp"
 #include "expu/containers/fixed_array.hpp"
 #include "expu/iterators/seq_iter.hpp"
+#include "expu/testing/checked_allocator.hpp"
+
+using checked_bool_array = expu::fixed_array<bool, expu::checked_allocator<std::allocator<bool>, true>>;
+
+
+//////////////////////////////////////FIXED ARRAY BOOL CHECKS///////////////////////////////////////////////////////////////////////////////
+
+
+template<class Alloc>
+testing::AssertionResult is_equal(const expu::fixed_array<bool, Alloc>& arr, const std::vector<bool>& expected)
+{
+    if (arr.size() != expected.size())
+        return testing::AssertionFailure() << "expu::fixed_array size (" << arr.size() << ") != range size (" << expected.size() << ")";
+
+    if (arr.end() - arr.begin() != static_cast<std::ptrdiff_t>(expected.size()))
+        return testing::AssertionFailure() << "expu::fixed_array iterator distance does not match its size";
+
+    size_t index = 0;
+    for (auto iter = arr.begin(); iter != arr.end(); ++iter, ++index) {
+        if (*iter != expected[index] || arr[index] != expected[index])
+            return testing::AssertionFailure() << "At index: (" << index << "). expu::fixed_array elements did not compare equal to range!";
+    }
+
+    return testing::AssertionSuccess();
+}
+
+//Every third bit is set, spanning multiple words and a partial last word.
+static std::vector<bool> _test_bits(const size_t size)
+{
+    std::vector<bool> bits(size);
+    for (size_t i = 0; i < size; ++i)
+        bits[i] = i % 3 == 0;
+
+    return bits;
+}
+
+
+//////////////////////////////////////FIXED ARRAY BOOL TESTS///////////////////////////////////////////////////////////////////////////////
 
 
 TEST(fixed_array_bool_tests, construction)
 {
+    for (const size_t test_size : { 0, 1, 63, 64, 65, 130, 1000 }) {
+        const checked_bool_array filled(test_size, true);
+        ASSERT_TRUE(is_equal(filled, std::vector<bool>(test_size, true)));
+
+        const std::vector<bool> expected = _test_bits(test_size);
+        const checked_bool_array arr(expected.begin(), expected.end());
+        ASSERT_TRUE(is_equal(arr, expected));
+
+        const checked_bool_array copy(arr);
+        ASSERT_TRUE(is_equal(copy, expected));
+    }
+}
+
+TEST(fixed_array_bool_tests, assignment)
+{
+    constexpr size_t test_size = 200;
+
+    const std::vector<bool> expected = _test_bits(test_size);
+    checked_bool_array arr(test_size, false);
+
+    for (size_t i = 0; i < test_size; ++i)
+        arr[i] = expected[i];
+
+    ASSERT_TRUE(is_equal(arr, expected));
+
+    //Assigning through a reference assigns the referenced bit
+    arr[1] = arr[0];
+    ASSERT_TRUE(arr[1]);
+    arr[1] = false;
+
+    checked_bool_array other(10, true);
+    other = arr;
+    ASSERT_TRUE(is_equal(other, expected));
+
+    other.assign(expected.rbegin(), expected.rend());
+    ASSERT_TRUE(is_equal(other, std::vector<bool>(expected.rbegin(), expected.rend())));
+
+    other = checked_bool_array(5, true);
+    ASSERT_TRUE(is_equal(other, std::vector<bool>(5, true)));
+}
+
+TEST(fixed_array_bool_tests, iterator_arithmetic)
+{
+    constexpr ptrdiff_t test_size = 300;
+
+    const std::vector<bool> expected = _test_bits(test_size);
+    const checked_bool_array arr(expected.begin(), expected.end());
+
+    for (ptrdiff_t i = 0; i <= test_size; i += 7) {
+        for (ptrdiff_t j = 0; j <= test_size; j += 11) {
+            auto iter = arr.begin() + i;
+            ASSERT_EQ(iter - arr.begin(), i);
+
+            iter += j - i;
+            ASSERT_EQ(iter, arr.begin() + j);
+            ASSERT_EQ((i < j), (arr.begin() + i < iter));
+
+            if (j != test_size) {
+                ASSERT_EQ(*iter, expected[j]);
+            }
+        }
+    }
+
+    auto iter = arr.end();
+    for (ptrdiff_t i = test_size - 1; i >= 0; --i)
+        ASSERT_EQ(*--iter, expected[i]);
+}
+
+TEST(fixed_array_bool_tests, count_and_find)
+{
+    for (const size_t test_size : { 0, 1, 64, 100, 257, 1000 }) {
+        std::vector<bool> expected(test_size, false);
+
+        //Set bits are sparse, such that whole words are skipped
+        for (size_t i = 0; i < test_size; i += 331)
+            expected[i] = true;
+
+        const checked_bool_array arr(expected.begin(), expected.end());
+
+        ASSERT_EQ(arr.count(), static_cast<size_t>(std::ranges::count(expected, true)));
+        ASSERT_EQ(arr.count(false), static_cast<size_t>(std::ranges::count(expected, false)));
+
+        ASSERT_EQ(arr.any(),  std::ranges::any_of(expected, std::identity{}));
+        ASSERT_EQ(arr.none(), std::ranges::none_of(expected, std::identity{}));
+        ASSERT_EQ(arr.all(),  std::ranges::all_of(expected, std::identity{}));
+
+        for (const bool value : { true, false }) {
+            const auto expected_first = std::ranges::find(expected, value) - expected.begin();
+            ASSERT_EQ(arr.find_first(value), static_cast<size_t>(expected_first));
+
+            for (size_t pos = 0; pos < test_size; ++pos) {
+                const auto expected_next = std::find(expected.begin() + pos + 1, expected.end(), value) - expected.begin();
+                ASSERT_EQ(arr.find_next(pos, value), static_cast<size_t>(expected_next));
+            }
+        }
+
+        //Subranges starting and ending mid-word
+        for (size_t first = 0; first < test_size; first += 13) {
+            for (size_t last = first; last <= test_size; last += 29) {
+                const auto expected_count = std::count(expected.begin() + first, expected.begin() + last, true);
+                ASSERT_EQ(expu::count(arr.begin() + first, arr.begin() + last, true), expected_count);
+
+                const auto expected_found = std::find(expected.begin() + first, expected.begin() + last, true) - expected.begin();
+                ASSERT_EQ(expu::find(arr.begin() + first, arr.begin() + last, true) - arr.begin(), expected_found);
+            }
+        }
+    }
+
+    const checked_bool_array all_set(300, true);
+    ASSERT_TRUE(all_set.all());
+    ASSERT_EQ(expu::count(all_set, true), 300);
+    ASSERT_EQ(expu::find(all_set, false), all_set.end());
+}
+
+TEST(fixed_array_bool_tests, bitwise_operations)
+{
+    for (const size_t test_size : { 0, 1, 64, 100, 300, 1000 }) {
+        std::vector<bool> lhs_bits(test_size), rhs_bits(test_size);
+        for (size_t i = 0; i < test_size; ++i) {
+            lhs_bits[i] = i % 3 == 0;
+            rhs_bits[i] = i % 5 < 2;
+        }
+
+        const checked_bool_array lhs(lhs_bits.begin(), lhs_bits.end());
+        const checked_bool_array rhs(rhs_bits.begin(), rhs_bits.end());
+
+        const auto expected_of = [&](auto op) {
+            std::vector<bool> result(test_size);
+            for (size_t i = 0; i < test_size; ++i)
+                result[i] = op(lhs_bits[i], rhs_bits[i]);
+
+            return result;
+        };
+
+        const std::vector<bool> expected_and     = expected_of([](bool l, bool r) { return l && r;  });
+        const std::vector<bool> expected_or      = expected_of([](bool l, bool r) { return l || r;  });
+        const std::vector<bool> expected_xor     = expected_of([](bool l, bool r) { return l != r;  });
+        const std::vector<bool> expected_and_not = expected_of([](bool l, bool r) { return l && !r; });
+        const std::vector<bool> expected_flip    = expected_of([](bool l, bool)   { return !l;      });
+
+        ASSERT_TRUE(is_equal(lhs & rhs,               expected_and));
+        ASSERT_TRUE(is_equal(lhs | rhs,               expected_or));
+        ASSERT_TRUE(is_equal(lhs ^ rhs,               expected_xor));
+        ASSERT_TRUE(is_equal(expu::and_not(lhs, rhs), expected_and_not));
+        ASSERT_TRUE(is_equal(~lhs,                    expected_flip));
+
+        //Padding bits must remain unset after flipping
+        ASSERT_EQ((~lhs).count(), static_cast<size_t>(std::ranges::count(expected_flip, true)));
+
+        ASSERT_EQ(lhs.count_and(rhs),     static_cast<size_t>(std::ranges::count(expected_and, true)));
+        ASSERT_EQ(lhs.count_or(rhs),      static_cast<size_t>(std::ranges::count(expected_or, true)));
+        ASSERT_EQ(lhs.count_xor(rhs),     static_cast<size_t>(std::ranges::count(expected_xor, true)));
+        ASSERT_EQ(lhs.count_and_not(rhs), static_cast<size_t>(std::ranges::count(expected_and_not, true)));
+
+        for (const size_t shift : { 0, 1, 7, 63, 64, 65, 130, 999, 1000 }) {
+            std::vector<bool> expected_up(test_size), expected_down(test_size);
+            for (size_t i = 0; i + shift < test_size; ++i) {
+                expected_up[i + shift] = lhs_bits[i];
+                expected_down[i]       = lhs_bits[i + shift];
+            }
+
+            const checked_bool_array shifted_up = lhs << shift;
+            ASSERT_TRUE(is_equal(shifted_up, expected_up));
+            ASSERT_EQ(shifted_up.count(), static_cast<size_t>(std::ranges::count(expected_up, true)));
+
+            ASSERT_TRUE(is_equal(lhs >> shift, expected_down));
+        }
+    }
+}
+
+TEST(fixed_array_bool_tests, byte_and_predicate_packing)
+{
+    for (const size_t test_size : { 0, 1, 31, 64, 100, 257, 1000 }) {
+        const std::vector<bool> expected = _test_bits(test_size);
+
+        //Any non-zero byte is packed as set
+        std::vector<uint8_t> bytes(test_size);
+        for (size_t i = 0; i < test_size; ++i)
+            bytes[i] = expected[i] ? static_cast<uint8_t>(i | 1) : 0;
+
+        const checked_bool_array from_bytes(bytes.data(), bytes.data() + test_size);
+        ASSERT_TRUE(is_equal(from_bytes, expected));
+        ASSERT_EQ(from_bytes.count(), static_cast<size_t>(std::ranges::count(expected, true)));
+
+        const std::unique_ptr<bool[]> flags(new bool[test_size + 1]);
+        from_bytes.unpack_into(std::span<bool>(flags.get(), test_size));
+        ASSERT_TRUE(std::equal(flags.get(), flags.get() + test_size, expected.begin(), expected.end()));
+
+        std::vector<uint8_t> unpacked(test_size);
+        from_bytes.unpack_into(unpacked);
+        ASSERT_TRUE(std::equal(unpacked.begin(), unpacked.end(), expected.begin(), expected.end()));
+
+        checked_bool_array reassigned(test_size, true);
+        reassigned.assign(flags.get(), flags.get() + test_size);
+        ASSERT_TRUE(is_equal(reassigned, expected));
+
+        //Predicates over a numeric range
+        std::vector<double> values(test_size);
+        for (size_t i = 0; i < test_size; ++i)
+            values[i] = static_cast<double>(i % 3);
+
+        const auto below_threshold = [](const double value) { return value < 0.5; };
+
+        ASSERT_TRUE(is_equal(checked_bool_array(values, below_threshold), expected));
+
+        checked_bool_array assigned(test_size / 2 + 1, true);
+        assigned.assign(values, below_threshold);
+        ASSERT_TRUE(is_equal(assigned, expected));
+
+        assigned.assign(values, std::not_fn(below_threshold));
+        ASSERT_EQ(assigned.count(), test_size - static_cast<size_t>(std::ranges::count(expected, true)));
+    }
+}
+
+
+
+//////////////////////////////////////FIXED ARRAY ALLOCATOR TESTS///////////////////////////////////////////////////////////////////////////////
+
+
+TEST(fixed_array_tests, arena_allocator)
+{
+    using allocator_type = expu::arena_allocator<std::string>;
+    using array_type     = expu::fixed_array<std::string, allocator_type>;
+
+    expu::arena first_arena(256), second_arena;
+
+    array_type arr(100, std::string(32, 'x'), allocator_type(first_arena));
+
+    //Allocators never propagate, hence elements are copied (or moved) between arenas
+    array_type other{ allocator_type(second_arena) };
+    other = arr;
+    ASSERT_EQ(other.get_allocator(), allocator_type(second_arena));
+    ASSERT_TRUE(std::equal(arr.begin(), arr.end(), other.begin(), other.end()));
+
+    array_type moved{ allocator_type(second_arena) };
+    moved = std::move(arr);
+    ASSERT_EQ(moved.get_allocator(), allocator_type(second_arena));
+    ASSERT_TRUE(std::equal(moved.begin(), moved.end(), other.begin(), other.end()));
+
+    //Moving within an arena steals the elements
+    const std::string* const elements = std::to_address(other.begin());
+    array_type stolen{ allocator_type(second_arena) };
+    stolen = std::move(other);
+    ASSERT_EQ(std::to_address(stolen.begin()), elements);
+
+    using bool_allocator_type = expu::arena_allocator<bool>;
+    using bool_array_type     = expu::fixed_array<bool, bool_allocator_type>;
+
+    const std::vector<bool> expected = _test_bits(1000);
+
+    bool_array_type bits(expected.begin(), expected.end(), bool_allocator_type(first_arena));
+    bool_array_type moved_bits{ bool_allocator_type(second_arena) };
+    moved_bits = std::move(bits);
+    ASSERT_EQ(moved_bits.get_allocator(), bool_allocator_type(second_arena));
+    ASSERT_TRUE(is_equal(moved_bits, expected));
+}
+
+TEST(fixed_array_tests, page_allocator)
+{
+    using allocator_type = expu::page_allocator<int>;
+    using array_type     = expu::fixed_array<int, allocator_type>;
+
+    constexpr int test_size = 100000;
+
+    array_type arr(test_size, 7);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(std::to_address(arr.begin())) % expu::page_size(), 0);
+    ASSERT_TRUE(std::ranges::all_of(arr, [](const int value) { return value == 7; }));
+
+    //Page allocators always compare equal, hence moves steal the pages
+    const array_type copy = arr;
+    const int* const elements = std::to_address(arr.begin());
+
+    array_type moved{ allocator_type() };
+    moved = std::move(arr);
+    ASSERT_EQ(std::to_address(moved.begin()), elements);
+    ASSERT_TRUE(std::ranges::equal(moved, copy));
+
+    //Words of bool arrays are allocated through the rebound page allocator
+    using bool_allocator_type = expu::page_allocator<bool>;
+    using bool_array_type     = expu::fixed_array<bool, bool_allocator_type>;
+
+    for (const size_t bits_size : { size_t(0), size_t(1), size_t(1000), size_t(test_size) }) {
+        const std::vector<bool> expected = _test_bits(bits_size);
+
+        bool_array_type bits(expected.begin(), expected.end());
+        ASSERT_TRUE(is_equal(bits, expected));
+        ASSERT_EQ(bits.count(), static_cast<size_t>(std::ranges::count(expected, true)));
+
+        std::vector<bool> expected_flip = expected;
+        expected_flip.flip();
+        ASSERT_TRUE(is_equal(~bits, expected_flip));
+        ASSERT_TRUE(is_equal(bits ^ ~bits, std::vector<bool>(bits_size, true)));
 
+        bool_array_type moved_bits{ bool_allocator_type() };
+        moved_bits = std::move(bits);
+        ASSERT_TRUE(is_equal(moved_bits, expected));
+    }
 }
\ No newline at end of file
@@ -0,0 +1,297 @@
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "expu/containers/flat_hash_map.hpp"
+
+#include "expu/testing/checked_allocator.hpp"
+
+
+//Hashes every key to the same probe sequence, so that all elements share their groups.
+struct _colliding_hash {
+    size_t operator()(const int) const noexcept { return 0; }
+};
+
+//Move only key, hashed and compared by the value it points to.
+struct _unique_key {
+    std::unique_ptr<int> value;
+
+    friend bool operator==(const _unique_key& lhs, const _unique_key& rhs) noexcept { return *lhs.value == *rhs.value; }
+};
+
+struct _unique_key_hash {
+    size_t operator()(const _unique_key& key) const noexcept { return std::hash<int>()(*key.value); }
+};
+
+//Key counting its copies, whose moves cannot throw.
+struct _counted_key {
+    static inline size_t copies = 0;
+
+    explicit _counted_key(const int value): value(std::to_string(value)) {}
+
+    _counted_key(const _counted_key& other): value(other.value) { ++copies; }
+    _counted_key(_counted_key&&) noexcept = default;
+
+    _counted_key& operator=(const _counted_key&) = delete;
+
+    std::string value;
+
+    friend bool operator==(const _counted_key& lhs, const _counted_key& rhs) noexcept { return lhs.value == rhs.value; }
+};
+
+struct _counted_key_hash {
+    size_t operator()(const _counted_key& key) const noexcept { return std::hash<std::string>()(key.value); }
+};
+
+//Hash throwing once it has been called a given number of times.
+struct _throwing_hash {
+    static inline size_t calls_left = std::numeric_limits<size_t>::max();
+
+    size_t operator()(const int key) const
+    {
+        if (calls_left-- == 0)
+            throw std::runtime_error("Hash failed!");
+
+        return std::hash<int>()(key);
+    }
+};
+
+template<class Map>
+static void _verify_matches(const Map& map, const std::unordered_map<int, int>& expected)
+{
+    ASSERT_EQ(map.size(), expected.size());
+    ASSERT_LE(map.size(), map.capacity() - map.capacity() / 8);
+
+    size_t iterated = 0;
+    for (const auto& [key, value] : map) {
+        ASSERT_EQ(expected.at(key), value);
+        ++iterated;
+    }
+
+    ASSERT_EQ(iterated, expected.size());
+}
+
+//Applies random insertions, erasions and lookups to both maps. Keys are drawn from a small range, so that slots
+//are repeatedly deleted and refilled.
+template<class Map>
+static void _verify_random_operations(const int key_range, const size_t operations)
+{
+    std::mt19937 generator(static_cast<uint32_t>(key_range));
+    std::uniform_int_distribution<int> keys(0, key_range - 1);
+
+    Map map;
+    std::unordered_map<int, int> expected;
+
+    for (size_t i = 0; i < operations; ++i) {
+        const int key = keys(generator);
+
+        switch (generator() % 4) {
+        case 0:
+        case 1:
+            ASSERT_EQ(map.try_emplace(key, static_cast<int>(i)).second, expected.try_emplace(key, static_cast<int>(i)).second);
+            break;
+        case 2:
+            ASSERT_EQ(map.erase(key), expected.erase(key));
+            break;
+        case 3:
+            ASSERT_EQ(map.contains(key), expected.contains(key));
+            if (map.contains(key)) {
+                ASSERT_EQ(map.at(key), expected.at(key));
+            }
+        }
+    }
+
+    _verify_matches(map, expected);
+}
+
+TEST(flat_hash_map_tests, random_operations)
+{
+    _verify_random_operations<expu::flat_hash_map<int, int>>(10, 1000);
+    _verify_random_operations<expu::flat_hash_map<int, int>>(1000, 100000);
+    _verify_random_operations<expu::flat_hash_map<int, int>>(100000, 300000);
+
+    //Every element probes the same groups
+    _verify_random_operations<expu::flat_hash_map<int, int, _colliding_hash>>(100, 10000);
+}
+
+TEST(flat_hash_map_tests, erase_during_iteration)
+{
+    expu::flat_hash_map<int, int> map;
+    std::unordered_map<int, int> expected;
+
+    for (int i = 0; i < 1000; ++i) {
+        map[i] = i;
+        expected[i] = i;
+    }
+
+    for (auto it = map.begin(); it != map.end(); ) {
+        if (it->first % 3 == 0) {
+            expected.erase(it->first);
+            it = map.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    _verify_matches(map, expected);
+
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.begin(), map.end());
+    ASSERT_EQ(map.find(1), map.end());
+}
+
+TEST(flat_hash_map_tests, allocator_aware_copies_and_moves)
+{
+    using allocator = expu::checked_allocator<std::allocator<std::pair<const std::string, std::string>>, false>;
+    using map_type  = expu::flat_hash_map<std::string, std::string, std::hash<std::string>, std::equal_to<std::string>, allocator>;
+
+    //Note: Checked allocators track memory per instance (and copies), hence memory may only be exchanged between
+    //maps whose allocators are copies of one another
+    const allocator alloc;
+
+    map_type map({ { "one", "1" }, { "two", "2" }, { "one", "uno" } }, alloc);
+    ASSERT_EQ(map.size(), 2);
+    ASSERT_EQ(map.at("one"), "1");
+    ASSERT_THROW((void)map.at("three"), std::out_of_range);
+
+    for (int i = 0; i < 100; ++i)
+        map.insert_or_assign(std::to_string(i), std::string(i, 'x'));
+
+    map.insert_or_assign(std::string("one"), std::string("eins"));
+    ASSERT_EQ(map["one"], "eins");
+    ASSERT_FALSE(map.emplace("two", "zwei").second);
+
+    map_type copy(map);
+    ASSERT_EQ(copy, map);
+
+    copy.erase("one");
+    ASSERT_NE(copy, map);
+
+    copy = map;
+    ASSERT_EQ(copy, map);
+
+    map_type moved(std::move(copy));
+    ASSERT_EQ(moved, map);
+    ASSERT_TRUE(copy.empty());
+
+    map_type moved_with_alloc(std::move(moved), moved.get_allocator());
+    ASSERT_EQ(moved_with_alloc, map);
+
+    moved_with_alloc = std::move(map);
+    ASSERT_EQ(moved_with_alloc.size(), 102);
+
+    map_type swapped(alloc);
+    swap(swapped, moved_with_alloc);
+    ASSERT_TRUE(moved_with_alloc.empty());
+    ASSERT_EQ(swapped.at("99"), std::string(99, 'x'));
+
+    swapped.reserve(10000);
+    ASSERT_GE(swapped.capacity(), 10000);
+    ASSERT_EQ(swapped.at("42"), std::string(42, 'x'));
+}
+
+TEST(flat_hash_map_tests, try_emplace_from_own_element)
+{
+    expu::flat_hash_map<int, std::string> map;
+    map.try_emplace(0, std::string(64, 'x'));
+
+    //Note: Mapped values refer to an element of the map, which must outlive every growth of the table
+    for (int i = 1; i < 1000; ++i)
+        ASSERT_TRUE(map.try_emplace(i, map.at(0)).second);
+
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_EQ(map.at(i), std::string(64, 'x'));
+}
+
+TEST(flat_hash_map_tests, keys_differing_in_high_bits)
+{
+    //Note: std::hash of integers is the identity, hence these keys only differ in bits which a hash mixed by
+    //multiplication alone would never bring down to h1's low bits or to h2
+    std::unordered_set<size_t> low_bits, h2s;
+    for (uint64_t i = 0; i < 4096; ++i) {
+        low_bits.insert(expu::_mix_hash(static_cast<size_t>(i << 44)) & 0xFFF);
+        h2s.insert(static_cast<size_t>(expu::_hash_h2(expu::_mix_hash(static_cast<size_t>(i << 40)))));
+    }
+
+    ASSERT_GT(low_bits.size(), 2048);
+    ASSERT_EQ(h2s.size(), 128);
+
+    expu::flat_hash_map<uint64_t, uint64_t> map;
+    for (uint64_t i = 0; i < 20000; ++i)
+        ASSERT_TRUE(map.try_emplace(i << 44, i).second);
+
+    for (uint64_t i = 0; i < 20000; ++i)
+        ASSERT_EQ(map.at(i << 44), i);
+}
+
+TEST(flat_hash_map_tests, move_only_keys)
+{
+    expu::flat_hash_map<_unique_key, int, _unique_key_hash> map;
+
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_TRUE(map.try_emplace(_unique_key{ std::make_unique<int>(i) }, i).second);
+
+    ASSERT_FALSE(map.try_emplace(_unique_key{ std::make_unique<int>(42) }, 0).second);
+    ASSERT_TRUE(map.emplace(_unique_key{ std::make_unique<int>(1000) }, 1000).second);
+
+    for (int i = 0; i <= 1000; ++i)
+        ASSERT_EQ(map.at(_unique_key{ std::make_unique<int>(i) }), i);
+
+    auto moved = std::move(map);
+    ASSERT_EQ(moved.size(), 1001);
+
+    moved.erase(_unique_key{ std::make_unique<int>(7) });
+    ASSERT_FALSE(moved.contains(_unique_key{ std::make_unique<int>(7) }));
+}
+
+TEST(flat_hash_map_tests, growth_moves_keys)
+{
+    expu::flat_hash_map<_counted_key, int, _counted_key_hash> map;
+    _counted_key::copies = 0;
+
+    //Note: Keys are moved into the map, then from slot to slot each time the table grows
+    for (int i = 0; i < 100000; ++i)
+        map.try_emplace(_counted_key(i), i);
+
+    ASSERT_EQ(_counted_key::copies, 0);
+    ASSERT_EQ(map.at(_counted_key(99999)), 99999);
+
+    //Note: Inserting through a const key copies it once, growth included
+    const _counted_key key(100000);
+    map.try_emplace(key, 100000);
+    ASSERT_EQ(_counted_key::copies, 1);
+}
+
+TEST(flat_hash_map_tests, throwing_hash_during_growth)
+{
+    expu::flat_hash_map<int, std::string, _throwing_hash> map;
+
+    for (int i = 0; i < 1000; ++i) {
+        //Note: Only throws if the table grows, rehashing more than a few of its elements
+        _throwing_hash::calls_left = 4;
+
+        try {
+            map.try_emplace(i, std::string(32, 'x'));
+        }
+        catch (const std::runtime_error&) {
+            _throwing_hash::calls_left = std::numeric_limits<size_t>::max();
+            ASSERT_EQ(map.size(), static_cast<size_t>(i));
+
+            map.try_emplace(i, std::string(32, 'x'));
+        }
+    }
+
+    _throwing_hash::calls_left = std::numeric_limits<size_t>::max();
+    ASSERT_EQ(map.size(), 1000);
+
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_EQ(map.at(i), std::string(32, 'x'));
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expu/containers/flat_map.hpp"
+
+#include "expu/testing/checked_allocator.hpp"
+
+
+template<class Map>
+static void _verify_matches(const Map& map, const std::map<int, int>& expected)
+{
+    ASSERT_EQ(map.size(), expected.size());
+    ASSERT_TRUE(std::ranges::equal(map.keys(), expected | std::views::keys));
+    ASSERT_TRUE(std::ranges::equal(map.values(), expected | std::views::values));
+}
+
+TEST(flat_map_tests, lower_bound)
+{
+    for (size_t size = 0; size <= 100; ++size) {
+        expu::flat_map<int, int> map;
+        std::vector<int> keys;
+
+        for (int i = 0; i < static_cast<int>(size); ++i) {
+            map[2 * i] = i;
+            keys.push_back(2 * i);
+        }
+
+        //Every key, and every value between and either side of the keys
+        for (int key = -1; key <= 2 * static_cast<int>(size); ++key) {
+            const auto expected = std::ranges::lower_bound(keys, key) - keys.begin();
+
+            ASSERT_EQ(map.lower_bound(key) - map.begin(), expected) << "size: " << size << " key: " << key;
+            ASSERT_EQ(map.contains(key), key % 2 == 0 && key >= 0 && key < 2 * static_cast<int>(size));
+        }
+    }
+}
+
+TEST(flat_map_tests, insert_range_and_erase)
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> keys(0, 5000);
+
+    expu::flat_map<int, int> map;
+    std::map<int, int> expected;
+
+    for (int round = 0; round < 20; ++round) {
+        //Batches overlap both the map and themselves
+        std::vector<std::pair<int, int>> batch;
+        for (int i = 0; i < 500; ++i)
+            batch.emplace_back(keys(generator), round * 1000 + i);
+
+        map.insert_range(batch);
+        for (const auto& [key, value] : batch)
+            expected.try_emplace(key, value);
+
+        _verify_matches(map, expected);
+
+        for (int i = 0; i < 100; ++i) {
+            const int key = keys(generator);
+            ASSERT_EQ(map.erase(key), expected.erase(key));
+        }
+
+        _verify_matches(map, expected);
+    }
+
+    map.insert_range(std::vector<std::pair<int, int>>{});
+    _verify_matches(map, expected);
+
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.find(1), map.end());
+}
+
+TEST(flat_map_tests, single_element_modifiers)
+{
+    using allocator = expu::checked_allocator<std::allocator<std::string>, false>;
+
+    expu::flat_map<std::string, std::string, std::less<std::string>, allocator> map({ { "b", "2" }, { "a", "1" }, { "b", "two" } });
+
+    ASSERT_EQ(map.size(), 2);
+    ASSERT_EQ(map.at("b"), "2");
+    ASSERT_THROW((void)map.at("c"), std::out_of_range);
+
+    map["c"] = "3";
+    ASSERT_FALSE(map.try_emplace("a", "uno").second);
+    ASSERT_TRUE(map.insert({ "0", "0" }).second);
+
+    ASSERT_TRUE(std::ranges::equal(map.keys(), std::vector<std::string>{ "0", "a", "b", "c" }));
+
+    auto it = map.erase(map.find("a"));
+    ASSERT_EQ(it->first, "b");
+    it->second = "bee";
+
+    std::vector<std::pair<std::string, std::string>> elements;
+    for (const auto [key, value] : map)
+        elements.emplace_back(key, value);
+
+    ASSERT_EQ(elements, (std::vector<std::pair<std::string, std::string>>{ { "0", "0" }, { "b", "bee" }, { "c", "3" } }));
+
+    auto copy = map;
+    ASSERT_EQ(copy, map);
+
+    copy.insert_range(std::vector<std::pair<std::string, std::string>>{ { "d", "4" }, { "b", "B" } });
+    ASSERT_NE(copy, map);
+    ASSERT_EQ(copy.at("b"), "bee");
+
+    swap(copy, map);
+    ASSERT_EQ(map.size(), 4);
+}
@@ -0,0 +1,67 @@
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <string>
+
+#include "expu/containers/inplace_darray.hpp"
+
+#include "expu/iterators/seq_iter.hpp"
+
+
+//////////////////////////////////////INPLACE DARRAY TESTS///////////////////////////////////////////////////////////////////////////////
+
+
+constexpr int _constexpr_inplace_darray_sum()
+{
+    expu::inplace_darray<int, 8> arr{ 1, 2, 3 };
+    arr.emplace(arr.begin(), 0);
+    arr.push_back(4);
+
+    const int values[] = { 7, 8 };
+    arr.insert(arr.begin() + 1, values, values + 2);
+    arr.erase(arr.begin() + 1);
+
+    auto moved = std::move(arr);
+
+    int sum = 0;
+    for (const int value : moved)
+        sum = sum * 10 + value;
+
+    return sum + static_cast<int>(arr.size());
+}
+
+TEST(inplace_darray_tests, constant_evaluation)
+{
+    static_assert(_constexpr_inplace_darray_sum() == 81234);
+}
+
+TEST(inplace_darray_tests, capacity_exceeded)
+{
+    expu::inplace_darray<std::string, 4> arr;
+    for (int i = 0; i < 4; ++i)
+        arr.emplace(arr.begin(), 32, static_cast<char>('a' + i));
+
+    ASSERT_TRUE(arr.full());
+    ASSERT_THROW(arr.emplace_back("e"), std::bad_alloc);
+    ASSERT_THROW(arr.insert(arr.begin(), arr.begin(), arr.begin() + 1), std::bad_alloc);
+
+    ASSERT_EQ(arr.size(), 4);
+    ASSERT_EQ(arr[0], std::string(32, 'd'));
+    ASSERT_EQ(arr[3], std::string(32, 'a'));
+}
+
+TEST(inplace_darray_tests, move_only)
+{
+    expu::inplace_darray<std::unique_ptr<int>, 16> arr;
+    for (int i = 0; i < 16; ++i)
+        arr.upush_back(std::make_unique<int>(i));
+
+    arr.erase(arr.begin(), arr.begin() + 8);
+
+    auto moved = std::move(arr);
+    ASSERT_TRUE(arr.empty());
+    ASSERT_EQ(moved.size(), 8);
+
+    for (int i = 0; i < 8; ++i)
+        ASSERT_EQ(*moved[i], i + 8);
+}
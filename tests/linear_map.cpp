@@ -0,0 +1,181 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expu/allocators/arena.hpp"
+#include "expu/containers/darray.hpp"
+#include "expu/containers/linear_map.hpp"
+#include "expu/containers/split_linear_map.hpp"
+
+#include "expu/testing/checked_allocator.hpp"
+
+
+template<class Mapped>
+static Mapped _make_mapped(const size_t i)
+{
+    if constexpr (std::is_same_v<Mapped, std::string>)
+        return std::to_string(i);
+    else
+        return static_cast<Mapped>(i);
+}
+
+//Looks up every key, a missing key and duplicated keys, for maps of sizes either side of each vector width.
+template<class Key, class Mapped, class Container = std::vector<std::pair<Key, Mapped>>>
+static void _verify_find(Key (*make_key)(size_t))
+{
+    for (size_t size = 0; size <= 130; ++size) {
+        expu::linear_map<Key, Mapped, Container> map;
+
+        for (size_t i = 0; i < size; ++i)
+            map[make_key(i)] = _make_mapped<Mapped>(i);
+
+        ASSERT_EQ(map.size(), size);
+
+        for (size_t i = 0; i < size; ++i) {
+            const auto loc = map.find(make_key(i));
+            ASSERT_EQ(loc - map.begin(), static_cast<ptrdiff_t>(i)) << "size: " << size;
+            ASSERT_EQ(loc->second, _make_mapped<Mapped>(i));
+        }
+
+        ASSERT_EQ(map.find(make_key(size)), map.end());
+    }
+}
+
+template<class Type>
+static Type _make_integer(const size_t i) { return static_cast<Type>(i * 3 + 1); }
+
+static int* _make_pointer(const size_t i) { return reinterpret_cast<int*>((i + 1) * sizeof(int)); }
+
+TEST(linear_map_tests, find_scannable_keys)
+{
+    _verify_find<int8_t, int8_t>(_make_integer<int8_t>);
+    _verify_find<uint8_t, int>(_make_integer<uint8_t>);
+    _verify_find<int16_t, int16_t>(_make_integer<int16_t>);
+    _verify_find<int, int>(_make_integer<int>);
+    _verify_find<int, double>(_make_integer<int>);
+    _verify_find<uint64_t, uint64_t>(_make_integer<uint64_t>);
+    _verify_find<int*, char>(_make_pointer);
+    _verify_find<int, int, expu::darray<std::pair<int, int>>>(_make_integer<int>);
+
+    //Neither byte comparable nor contiguous
+    _verify_find<int, std::string>(_make_integer<int>);
+    _verify_find<double, int>(_make_integer<double>);
+}
+
+TEST(linear_map_tests, find_matches_first_key)
+{
+    //Mapped values equal to the key must never match
+    expu::linear_map<int, int> map(std::vector<std::pair<int, int>>{ { 1, 5 }, { 2, 5 }, { 5, 0 }, { 5, 1 } });
+
+    ASSERT_EQ(map.find(5) - map.begin(), 2);
+    ASSERT_EQ(map.find(0), map.end());
+}
+
+TEST(linear_map_tests, arena_allocator)
+{
+    using element_type   = std::pair<int, std::string>;
+    using allocator_type = expu::arena_allocator<element_type>;
+    using map_type       = expu::linear_map<int, std::string, expu::darray<element_type, allocator_type>>;
+
+    expu::arena first_arena(256), second_arena;
+
+    map_type map(allocator_type{ first_arena });
+    for (int i = 0; i < 100; ++i)
+        map[i] = std::string(32, static_cast<char>('a' + i % 26));
+
+    //Allocators never propagate, hence elements are copied (or moved) between arenas
+    map_type other(allocator_type{ second_arena });
+    other = map;
+    ASSERT_TRUE(std::ranges::equal(other, map));
+
+    map_type moved(allocator_type{ second_arena });
+    moved = std::move(map);
+    ASSERT_TRUE(std::ranges::equal(moved, other));
+    ASSERT_EQ(moved.at(27), std::string(32, 'b'));
+
+    moved.erase(27);
+    ASSERT_EQ(moved.find(27), moved.end());
+    ASSERT_EQ(moved.size(), 99);
+}
+
+
+//////////////////////////////////////SPLIT LINEAR MAP TESTS///////////////////////////////////////////////////////////////////////////////
+
+
+template<class Key, class Mapped>
+static void _verify_split_find(Key (*make_key)(size_t))
+{
+    for (size_t size = 0; size <= 130; ++size) {
+        expu::split_linear_map<Key, Mapped> map;
+
+        for (size_t i = 0; i < size; ++i)
+            ASSERT_TRUE(map.try_emplace(make_key(i), _make_mapped<Mapped>(i)).second);
+
+        for (size_t i = 0; i < size; ++i) {
+            ASSERT_EQ(map.index_of(make_key(i)), i) << "size: " << size;
+            ASSERT_EQ(map.find(make_key(i))->second, _make_mapped<Mapped>(i));
+        }
+
+        ASSERT_EQ(map.find(make_key(size)), map.end());
+        ASSERT_FALSE(map.contains(make_key(size)));
+    }
+}
+
+TEST(split_linear_map_tests, find)
+{
+    _verify_split_find<int8_t, int>(_make_integer<int8_t>);
+    _verify_split_find<int16_t, std::string>(_make_integer<int16_t>);
+    _verify_split_find<int, int>(_make_integer<int>);
+    _verify_split_find<uint64_t, std::string>(_make_integer<uint64_t>);
+    _verify_split_find<int*, double>(_make_pointer);
+    _verify_split_find<double, int>(_make_integer<double>);
+}
+
+TEST(split_linear_map_tests, modifiers_and_iteration)
+{
+    using allocator = expu::checked_allocator<std::allocator<int>, false>;
+
+    expu::split_linear_map<int, std::string, allocator> map({ { 1, "one" }, { 2, "two" }, { 1, "uno" } });
+
+    ASSERT_EQ(map.size(), 2);
+    ASSERT_EQ(map.at(1), "one");
+    ASSERT_THROW((void)map.at(3), std::out_of_range);
+
+    map[3] = "three";
+    map[2] += "!";
+    ASSERT_FALSE(map.try_emplace(3, "drei").second);
+
+    map.erase(1);
+    map.erase(4);
+    ASSERT_FALSE(map.contains(1));
+
+    //Keys and values stay parallel after erasion
+    ASSERT_TRUE(std::ranges::equal(map.keys(), std::vector<int>{ 2, 3 }));
+    ASSERT_TRUE(std::ranges::equal(map.values(), std::vector<std::string>{ "two!", "three" }));
+
+    std::vector<std::pair<int, std::string>> elements;
+    for (const auto [key, value] : std::as_const(map))
+        elements.emplace_back(key, value);
+
+    ASSERT_EQ(elements, (std::vector<std::pair<int, std::string>>{ { 2, "two!" }, { 3, "three" } }));
+
+    for (auto it = map.begin(); it != map.end(); ++it)
+        it->second = std::to_string(it->first);
+
+    ASSERT_EQ(map.at(3), "3");
+    ASSERT_EQ(map.end() - map.begin(), 2);
+
+    auto copy = map;
+    ASSERT_EQ(copy, map);
+
+    copy[4] = "4";
+    ASSERT_NE(copy, map);
+
+    swap(copy, map);
+    ASSERT_EQ(map.size(), 3);
+    ASSERT_EQ(copy.size(), 2);
+}
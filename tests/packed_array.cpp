@@ -0,0 +1,132 @@
+#include "gtest/gtest.h"
+
+#include <random>
+#include <vector>
+
+#include "expu/containers/packed_array.hpp"
+
+
+template<size_t Bits>
+static std::vector<uint64_t> _random_values(const size_t size)
+{
+    std::mt19937_64 generator(Bits * 1000 + size);
+
+    std::vector<uint64_t> values(size);
+    for (uint64_t& value : values)
+        value = generator() & expu::packed_array<Bits>::max_value;
+
+    return values;
+}
+
+template<size_t Bits>
+static testing::AssertionResult _is_equal(const expu::packed_array<Bits>& arr, const std::vector<uint64_t>& expected)
+{
+    if (arr.size() != expected.size() || arr.end() - arr.begin() != static_cast<ptrdiff_t>(expected.size()))
+        return testing::AssertionFailure() << "expu::packed_array size did not match range size";
+
+    size_t index = 0;
+    for (auto iter = arr.begin(); iter != arr.end(); ++iter, ++index)
+        if (*iter != expected[index] || arr[index] != expected[index])
+            return testing::AssertionFailure() << "At index: (" << index << "). expu::packed_array elements did not compare equal to range!";
+
+    return testing::AssertionSuccess();
+}
+
+template<size_t Bits>
+static void _verify_packed_array()
+{
+    for (const size_t test_size : { 0, 1, 7, 64, 65, 1001 }) {
+        std::vector<uint64_t> expected = _random_values<Bits>(test_size);
+
+        expu::packed_array<Bits> arr(expected.begin(), expected.end());
+        ASSERT_TRUE(_is_equal(arr, expected));
+
+        ASSERT_TRUE(_is_equal(expu::packed_array<Bits>(test_size, expu::packed_array<Bits>::max_value),
+            std::vector<uint64_t>(test_size, expu::packed_array<Bits>::max_value)));
+
+        //Writing an element leaves its neighbours, in the same or adjacent words, unchanged
+        for (size_t i = 0; i < test_size; i += 3) {
+            expected[i] = expected[i] ^ 1;
+            arr[i] = static_cast<typename expu::packed_array<Bits>::value_type>(expected[i]);
+        }
+        ASSERT_TRUE(_is_equal(arr, expected));
+
+        //Assigning through references and iterator arithmetic
+        if (test_size > 1) {
+            arr[0] = arr[test_size - 1];
+            expected[0] = expected[test_size - 1];
+
+            auto iter = arr.end();
+            for (ptrdiff_t i = static_cast<ptrdiff_t>(test_size) - 1; i >= 0; --i)
+                ASSERT_EQ(*--iter, expected[static_cast<size_t>(i)]);
+
+            ASSERT_EQ((arr.begin() + 5 * static_cast<ptrdiff_t>(test_size / 7)) - arr.begin(), 5 * static_cast<ptrdiff_t>(test_size / 7));
+        }
+        ASSERT_TRUE(_is_equal(arr, expected));
+    }
+}
+
+TEST(packed_array_tests, element_access)
+{
+    _verify_packed_array<1>();
+    _verify_packed_array<7>();
+    _verify_packed_array<20>();
+    _verify_packed_array<32>();
+    _verify_packed_array<33>();
+    _verify_packed_array<63>();
+}
+
+template<size_t Bits>
+static void _verify_bulk_pack()
+{
+    for (const size_t test_size : { 0, 5, 8, 100, 1003 }) {
+        const std::vector<uint64_t> values = _random_values<Bits>(test_size);
+        const std::vector<uint32_t> narrowed(values.begin(), values.end());
+
+        expu::packed_array<Bits> arr(test_size + 10, 1);
+        arr.pack(narrowed);
+
+        std::vector<uint64_t> expected = values;
+        expected.resize(test_size + 10, 1);
+        ASSERT_TRUE(_is_equal(arr, expected));
+
+        const expu::darray<uint32_t> unpacked = arr.unpack();
+        ASSERT_TRUE(std::equal(unpacked.begin(), unpacked.end(), expected.begin(), expected.end()));
+    }
+}
+
+TEST(packed_array_tests, bulk_pack_and_unpack)
+{
+    _verify_bulk_pack<1>();
+    _verify_bulk_pack<13>();
+    _verify_bulk_pack<20>();
+    _verify_bulk_pack<25>();
+    _verify_bulk_pack<26>();
+    _verify_bulk_pack<32>();
+}
+
+TEST(packed_array_tests, algorithms_and_moves)
+{
+    expu::packed_array<20> arr(10, 3);
+
+    //Packed values are not bits, hence must not be counted or searched as such
+    ASSERT_EQ(expu::count(arr.begin(), arr.end(), 3u), 10);
+    ASSERT_EQ(expu::count(arr.begin(), arr.end(), 1u), 0);
+
+    arr[7] = 1;
+    ASSERT_EQ(expu::find(arr.cbegin(), arr.cend(), 1u) - arr.cbegin(), 7);
+
+    expu::packed_array<20> moved(std::move(arr));
+    ASSERT_EQ(moved.size(), 10);
+    ASSERT_EQ(moved[7], 1u);
+    ASSERT_TRUE(arr.empty());
+    ASSERT_EQ(arr.begin(), arr.end());
+
+    arr = std::move(moved);
+    ASSERT_EQ(arr.size(), 10);
+    ASSERT_TRUE(moved.empty());
+
+    moved = arr;
+    ASSERT_EQ(moved.size(), 10);
+    ASSERT_EQ(expu::count(moved.begin(), moved.end(), 3u), 9);
+}
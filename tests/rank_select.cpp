@@ -0,0 +1,54 @@
+#include "gtest/gtest.h"
+
+#include <random>
+#include <vector>
+
+#include "expu/containers/fixed_array.hpp"
+#include "expu/containers/rank_select.hpp"
+
+
+//Compares rank and select against a scan, for bitmaps with each bit set with the given probability.
+static void _verify_rank_select(const size_t size, const double density)
+{
+    std::mt19937_64 generator(size);
+    std::bernoulli_distribution distribution(density);
+
+    std::vector<bool> expected(size);
+    for (size_t i = 0; i < size; ++i)
+        expected[i] = distribution(generator);
+
+    const expu::fixed_array<bool> bits(expected.begin(), expected.end());
+    const expu::rank_select index(bits);
+
+    size_t rank = 0;
+    for (size_t pos = 0; pos < size; ++pos) {
+        ASSERT_EQ(index.rank(pos), rank) << "pos: " << pos;
+
+        if (expected[pos]) {
+            ASSERT_EQ(index.select(rank), pos) << "k: " << rank;
+            ++rank;
+        }
+    }
+
+    ASSERT_EQ(index.rank(size), rank);
+    ASSERT_EQ(index.count(), rank);
+    ASSERT_EQ(index.select(rank), size);
+}
+
+TEST(rank_select_tests, dense)
+{
+    _verify_rank_select(200000, 0.5);
+    _verify_rank_select(200000, 0.99);
+}
+
+TEST(rank_select_tests, sparse)
+{
+    _verify_rank_select(300000, 0.001);
+    _verify_rank_select(1000, 0.0);
+}
+
+TEST(rank_select_tests, edge_sizes)
+{
+    for (const size_t size : { 0, 1, 63, 64, 511, 512, 513, 65536, 65537 })
+        _verify_rank_select(size, 0.3);
+}
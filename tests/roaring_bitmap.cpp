@@ -0,0 +1,173 @@
+#include "gtest/gtest.h"
+
+#include <limits>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "expu/containers/fixed_array.hpp"
+#include "expu/containers/roaring_bitmap.hpp"
+
+
+//Bits spread over several chunks: sparse chunks, dense chunks, chunks of long runs and empty chunks.
+static std::vector<bool> _mixed_bits(const size_t seed)
+{
+    constexpr size_t chunk = size_t(1) << 16;
+
+    std::mt19937_64 generator(seed);
+    std::vector<bool> bits(6 * chunk + 1234);
+
+    std::bernoulli_distribution sparse(0.01), dense(0.6);
+
+    for (size_t i = 0; i < chunk; ++i)
+        bits[i] = sparse(generator);
+
+    for (size_t i = 2 * chunk; i < 3 * chunk; ++i)
+        bits[i] = dense(generator);
+
+    for (size_t run = 3 * chunk + generator() % 100; run < 4 * chunk; run += 1000 + generator() % 1000)
+        for (size_t i = run; i < std::min(run + 500, 4 * chunk); ++i)
+            bits[i] = true;
+
+    for (size_t i = 5 * chunk; i < bits.size(); ++i)
+        bits[i] = sparse(generator);
+
+    return bits;
+}
+
+static testing::AssertionResult _matches(const expu::roaring_bitmap& bitmap, const std::vector<bool>& expected)
+{
+    const expu::fixed_array<bool> dense = bitmap.to_fixed_array(expected.size());
+
+    for (size_t i = 0; i < expected.size(); ++i)
+        if (bitmap[i] != expected[i] || dense[i] != expected[i])
+            return testing::AssertionFailure() << "At index: (" << i << "). expu::roaring_bitmap did not match the expected bits!";
+
+    std::vector<size_t> positions;
+    for (size_t i = 0; i < expected.size(); ++i)
+        if (expected[i])
+            positions.push_back(i);
+
+    if (!std::ranges::equal(bitmap, positions))
+        return testing::AssertionFailure() << "expu::roaring_bitmap did not iterate over the set positions!";
+
+    if (bitmap.count() != positions.size())
+        return testing::AssertionFailure() << "expu::roaring_bitmap count (" << bitmap.count() << ") != " << positions.size();
+
+    return testing::AssertionSuccess();
+}
+
+TEST(roaring_bitmap_tests, fixed_array_round_trip)
+{
+    const std::vector<bool> expected = _mixed_bits(1);
+    const expu::fixed_array<bool> dense(expected.begin(), expected.end());
+
+    expu::roaring_bitmap bitmap(dense);
+    ASSERT_TRUE(_matches(bitmap, expected));
+
+    //Clustered bits take far less memory than the dense array
+    ASSERT_LT(bitmap.memory_usage(), dense.size() / 8);
+
+    //Truncated conversion leaves no padding bits set
+    const expu::fixed_array<bool> truncated = bitmap.to_fixed_array(3 * 65536 + 70);
+    ASSERT_EQ(truncated.count(), static_cast<size_t>(std::count(expected.begin(), expected.begin() + 3 * 65536 + 70, true)));
+
+    ASSERT_TRUE(_matches(expu::roaring_bitmap(expu::fixed_array<bool>(0, false)), {}));
+}
+
+TEST(roaring_bitmap_tests, insert_and_erase)
+{
+    std::vector<bool> expected = _mixed_bits(2);
+    expu::roaring_bitmap bitmap(expu::fixed_array<bool>(expected.begin(), expected.end()));
+
+    //Modifies every kind of container, growing arrays into bitmaps and shrinking bitmaps back into arrays
+    std::mt19937_64 generator(3);
+    for (size_t i = 0; i < 20000; ++i) {
+        const size_t pos = generator() % expected.size();
+        const bool value = i % 3 != 0;
+
+        ASSERT_EQ(value ? bitmap.insert(pos) : bitmap.erase(pos), expected[pos] != value);
+        expected[pos] = value;
+    }
+
+    for (size_t i = 65536; i < 65536 + 5000; ++i)
+        bitmap[i] = expected[i] = true;
+
+    for (size_t i = 65536; i < 65536 + 4000; ++i)
+        bitmap[i] = expected[i] = false;
+
+    ASSERT_TRUE(_matches(bitmap, expected));
+
+    bitmap.run_optimize();
+    ASSERT_TRUE(_matches(bitmap, expected));
+
+    bitmap.insert(expu::roaring_bitmap::npos - 1);
+    ASSERT_TRUE(bitmap.contains(expu::roaring_bitmap::npos - 1));
+    ASSERT_EQ(bitmap.find_next(expu::roaring_bitmap::npos - 1), expu::roaring_bitmap::npos);
+    ASSERT_EQ(bitmap.find_next(std::numeric_limits<size_t>::max()), expu::roaring_bitmap::npos);
+
+    //Positions past npos are never set, hence never erased, even where their low bits alias a set position
+    const size_t set_pos = 65536 + 4500;
+    ASSERT_FALSE(bitmap.erase(expu::roaring_bitmap::npos + set_pos));
+    bitmap[expu::roaring_bitmap::npos + set_pos] = false;
+    ASSERT_TRUE(bitmap.contains(set_pos));
+}
+
+TEST(roaring_bitmap_tests, find)
+{
+    const std::vector<bool> expected = _mixed_bits(4);
+    const expu::roaring_bitmap bitmap(expu::fixed_array<bool>(expected.begin(), expected.end()));
+
+    //Position of the first set bit at or after each position
+    std::vector<size_t> expected_next(expected.size() + 1, expu::roaring_bitmap::npos);
+    for (size_t pos = expected.size(); pos-- != 0; )
+        expected_next[pos] = expected[pos] ? pos : expected_next[pos + 1];
+
+    ASSERT_EQ(bitmap.find_first(), expected_next[0]);
+
+    for (size_t pos = 0; pos < expected.size(); ++pos)
+        ASSERT_EQ(bitmap.find_next(pos), expected_next[pos + 1]) << "pos: " << pos;
+
+    ASSERT_TRUE(bitmap.any());
+    ASSERT_TRUE(expu::roaring_bitmap().none());
+}
+
+TEST(roaring_bitmap_tests, set_operations)
+{
+    const std::vector<bool> lhs_bits = _mixed_bits(5);
+    std::vector<bool> rhs_bits = _mixed_bits(6);
+    rhs_bits.resize(lhs_bits.size() + 100000, true);
+
+    const expu::roaring_bitmap lhs(expu::fixed_array<bool>(lhs_bits.begin(), lhs_bits.end()));
+    const expu::roaring_bitmap rhs(expu::fixed_array<bool>(rhs_bits.begin(), rhs_bits.end()));
+
+    std::vector<bool> expected_or(rhs_bits.size()), expected_and(rhs_bits.size());
+    for (size_t i = 0; i < rhs_bits.size(); ++i) {
+        const bool lhs_bit = i < lhs_bits.size() && lhs_bits[i];
+
+        expected_or[i]  = lhs_bit || rhs_bits[i];
+        expected_and[i] = lhs_bit && rhs_bits[i];
+    }
+
+    ASSERT_TRUE(_matches(lhs | rhs, expected_or));
+    ASSERT_TRUE(_matches(lhs & rhs, expected_and));
+    ASSERT_TRUE(_matches(rhs & lhs, expected_and));
+
+    //Sparse arrays remain arrays when united, their union holding fewer values than a bitmap container has words
+    expu::roaring_bitmap small_lhs, small_rhs;
+    std::set<size_t> small_expected;
+
+    for (size_t i = 0; i < 1500; ++i) {
+        small_lhs.insert(i * 7);
+        small_rhs.insert(i * 5);
+        small_expected.insert(i * 7);
+        small_expected.insert(i * 5);
+    }
+
+    const expu::roaring_bitmap small_union = small_lhs | small_rhs;
+    ASSERT_LE(small_expected.size(), 4096);
+    ASSERT_TRUE(std::ranges::equal(small_union, small_expected));
+
+    //Note: A bitmap container alone takes 8KB
+    ASSERT_LT(small_union.memory_usage(), 8192);
+}
@@ -0,0 +1,84 @@
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <string>
+
+#include "expu/containers/small_darray.hpp"
+
+#include "expu/iterators/seq_iter.hpp"
+
+#include "expu/testing/checked_allocator.hpp"
+
+template<class Type, size_t N>
+using checked_small_darray = expu::small_darray<Type, N, expu::checked_allocator<std::allocator<Type>, true>>;
+
+
+//////////////////////////////////////SMALL DARRAY TESTS///////////////////////////////////////////////////////////////////////////////
+
+
+TEST(small_darray_tests, spill_and_shrink_inline)
+{
+    checked_small_darray<int, 8> arr;
+    ASSERT_TRUE(arr.is_inline());
+    ASSERT_EQ(arr.capacity(), 8);
+
+    for (int i = 0; i < 8; ++i)
+        arr.push_back(i);
+
+    ASSERT_TRUE(arr.is_inline());
+
+    arr.push_back(8);
+    ASSERT_FALSE(arr.is_inline());
+    ASSERT_TRUE(std::equal(arr.begin(), arr.end(), expu::seq_iter(0), expu::seq_iter(9)));
+
+    arr.erase(arr.begin() + 4, arr.end());
+    arr.shrink_to_fit();
+    ASSERT_TRUE(arr.is_inline());
+    ASSERT_TRUE(std::equal(arr.begin(), arr.end(), expu::seq_iter(0), expu::seq_iter(4)));
+
+    const int values[] = { 10, 11, 12, 13, 14, 15 };
+    arr.insert(arr.begin() + 2, std::begin(values), std::end(values));
+    ASSERT_EQ(arr.size(), 10);
+    ASSERT_EQ(arr[2], 10);
+    ASSERT_EQ(arr[8], 2);
+}
+
+TEST(small_darray_tests, move_only)
+{
+    checked_small_darray<std::unique_ptr<int>, 4> arr;
+
+    constexpr int test_size = 32;
+    for (int i = 0; i < test_size; ++i)
+        arr.emplace(arr.begin(), std::make_unique<int>(i));
+
+    for (int i = 0; i < test_size; ++i)
+        ASSERT_EQ(*arr[i], test_size - 1 - i);
+
+    //Heap memory is stolen, inline elements are moved
+    auto stolen = std::move(arr);
+    ASSERT_TRUE(arr.empty() && arr.is_inline());
+    ASSERT_EQ(stolen.size(), test_size);
+
+    stolen.erase(stolen.begin() + 2, stolen.end());
+    stolen.shrink_to_fit();
+
+    auto moved = std::move(stolen);
+    ASSERT_TRUE(moved.is_inline());
+    ASSERT_EQ(*moved[0], test_size - 1);
+    ASSERT_EQ(*moved[1], test_size - 2);
+}
+
+TEST(small_darray_tests, copy)
+{
+    checked_small_darray<std::string, 2> arr;
+    for (int i = 0; i < 10; ++i)
+        arr.emplace_back(32, static_cast<char>('a' + i));
+
+    checked_small_darray<std::string, 2> copy(arr);
+    ASSERT_TRUE(std::equal(arr.begin(), arr.end(), copy.begin(), copy.end()));
+
+    copy.erase(copy.begin() + 1, copy.end());
+    arr = copy;
+    ASSERT_EQ(arr.size(), 1);
+    ASSERT_EQ(arr[0], std::string(32, 'a'));
+}